@@ -21,16 +21,24 @@ typedef struct {
     hid_t   type_id;       /* The ID of the packet table's native datatype */
     hsize_t current_index; /* The index of the packet that get_next_packet will read next */
     hsize_t size;          /* The number of packets currently contained in this table */
+    size_t  type_size;     /* The size of one packet in memory, when appends are buffered */
+    void *  append_buf;    /* Packets appended but not yet written to the dataset */
+    size_t  append_nalloc; /* The number of packets the append buffer can hold */
+    size_t  append_nused;  /* The number of packets currently held in the append buffer */
 } htbl_t;
 
-static hsize_t    H5PT_ptable_count   = 0;
-static H5I_type_t H5PT_ptable_id_type = H5I_UNINIT;
+static hsize_t    H5PT_ptable_count       = 0;
+static H5I_type_t H5PT_ptable_id_type     = H5I_UNINIT;
+static hbool_t    H5PT_atclose_registered = FALSE;
 
 #define H5PT_HASH_TABLE_SIZE 64
 
 /* Packet Table private functions */
 static herr_t H5PT_free_id(void *id, void **_ctx);
+static void   H5PT_atclose(void *ctx);
 static herr_t H5PT_close(htbl_t *table);
+static herr_t H5PT_flush_append_buf(htbl_t *table);
+static htri_t H5PT_has_vlen(hid_t type_id);
 static herr_t H5PT_create_index(htbl_t *table_id);
 static herr_t H5PT_set_index(htbl_t *table_id, hsize_t pt_index);
 static herr_t H5PT_get_index(htbl_t *table_id, hsize_t *pt_index);
@@ -86,18 +94,29 @@ H5PTcreate(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chunk_si
     }
 
     /* Register the packet table ID type if this is the first table created */
-    if (H5PT_ptable_id_type < 0)
+    if (H5PT_ptable_id_type < 0) {
         if ((H5PT_ptable_id_type =
                  H5Iregister_type((size_t)H5PT_HASH_TABLE_SIZE, 0, (H5I_free_t)H5PT_free_id)) < 0)
             goto error;
+        /* Release tables left open while their datasets are still usable */
+        if (!H5PT_atclose_registered) {
+            if (H5atclose(H5PT_atclose, NULL) < 0)
+                goto error;
+            H5PT_atclose_registered = TRUE;
+        }
+    }
 
     /* Get memory for the table identifier */
     table = (htbl_t *)HDmalloc(sizeof(htbl_t));
     if (table == NULL) {
         goto error;
     }
-    table->dset_id = H5I_INVALID_HID;
-    table->type_id = H5I_INVALID_HID;
+    table->dset_id       = H5I_INVALID_HID;
+    table->type_id       = H5I_INVALID_HID;
+    table->type_size     = 0;
+    table->append_buf    = NULL;
+    table->append_nalloc = 0;
+    table->append_nused  = 0;
 
     /* Create a simple data space with unlimited size */
     dims[0]       = 0;
@@ -207,18 +226,29 @@ H5PTcreate_fl(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chunk
     }
 
     /* Register the packet table ID type if this is the first table created */
-    if (H5PT_ptable_id_type < 0)
+    if (H5PT_ptable_id_type < 0) {
         if ((H5PT_ptable_id_type =
                  H5Iregister_type((size_t)H5PT_HASH_TABLE_SIZE, 0, (H5I_free_t)H5PT_free_id)) < 0)
             goto error;
+        /* Release tables left open while their datasets are still usable */
+        if (!H5PT_atclose_registered) {
+            if (H5atclose(H5PT_atclose, NULL) < 0)
+                goto error;
+            H5PT_atclose_registered = TRUE;
+        }
+    }
 
     /* Get memory for the table identifier */
     table = (htbl_t *)HDmalloc(sizeof(htbl_t));
     if (table == NULL) {
         goto error;
     }
-    table->dset_id = H5I_INVALID_HID;
-    table->type_id = H5I_INVALID_HID;
+    table->dset_id       = H5I_INVALID_HID;
+    table->type_id       = H5I_INVALID_HID;
+    table->type_size     = 0;
+    table->append_buf    = NULL;
+    table->append_nalloc = 0;
+    table->append_nused  = 0;
 
     /* Create a simple data space with unlimited size */
     dims[0]       = 0;
@@ -322,17 +352,28 @@ H5PTopen(hid_t loc_id, const char *dset_name)
     }
 
     /* Register the packet table ID type if this is the first table created */
-    if (H5PT_ptable_id_type < 0)
+    if (H5PT_ptable_id_type < 0) {
         if ((H5PT_ptable_id_type =
                  H5Iregister_type((size_t)H5PT_HASH_TABLE_SIZE, 0, (H5I_free_t)H5PT_free_id)) < 0)
             goto error;
+        /* Release tables left open while their datasets are still usable */
+        if (!H5PT_atclose_registered) {
+            if (H5atclose(H5PT_atclose, NULL) < 0)
+                goto error;
+            H5PT_atclose_registered = TRUE;
+        }
+    }
 
     table = (htbl_t *)HDmalloc(sizeof(htbl_t));
     if (table == NULL) {
         goto error;
     }
-    table->dset_id = H5I_INVALID_HID;
-    table->type_id = H5I_INVALID_HID;
+    table->dset_id       = H5I_INVALID_HID;
+    table->type_id       = H5I_INVALID_HID;
+    table->type_size     = 0;
+    table->append_buf    = NULL;
+    table->append_nalloc = 0;
+    table->append_nused  = 0;
 
     /* Open the dataset */
     if ((table->dset_id = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
@@ -404,10 +445,49 @@ error:
 static herr_t
 H5PT_free_id(void *id, void H5_ATTR_UNUSED **_ctx)
 {
-    HDfree(id);
+    htbl_t *table = (htbl_t *)id;
+
+    /* Try to write out any buffered packets and close the table's objects;
+     * there is no one to report a failure to */
+    H5E_BEGIN_TRY
+    {
+        H5PT_flush_append_buf(table);
+        H5Dclose(table->dset_id);
+        H5Tclose(table->type_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(table->append_buf);
+    HDfree(table);
     return SUCCEED;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: H5PT_atclose
+ *
+ * Purpose: Frees the packet tables still open at library shutdown.
+ *          Callback for H5atclose, which runs before the library closes
+ *          the tables' datasets.
+ *
+ * Return: void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PT_atclose(void H5_ATTR_UNUSED *ctx)
+{
+    /* Destroying the type frees every table still registered with it */
+    if (H5PT_ptable_id_type > 0) {
+        H5E_BEGIN_TRY
+        {
+            H5Idestroy_type(H5PT_ptable_id_type);
+        }
+        H5E_END_TRY;
+    }
+    H5PT_ptable_id_type     = H5I_UNINIT;
+    H5PT_ptable_count       = 0;
+    H5PT_atclose_registered = FALSE;
+}
+
 /*-------------------------------------------------------------------------
  * Function: H5PT_close
  *
@@ -433,6 +513,10 @@ H5PT_close(htbl_t *table)
     if (table == NULL)
         goto error;
 
+    /* Write out any buffered packets */
+    if (H5PT_flush_append_buf(table) < 0)
+        goto error;
+
     /* Close the dataset */
     if (H5Dclose(table->dset_id) < 0)
         goto error;
@@ -441,6 +525,7 @@ H5PT_close(htbl_t *table)
     if (H5Tclose(table->type_id) < 0)
         goto error;
 
+    HDfree(table->append_buf);
     HDfree(table);
 
     return SUCCEED;
@@ -451,6 +536,7 @@ error:
         H5Dclose(table->dset_id);
         H5Tclose(table->type_id);
         H5E_END_TRY
+        HDfree(table->append_buf);
         HDfree(table);
     }
     return FAIL;
@@ -542,6 +628,39 @@ H5PTappend(hid_t table_id, size_t nrecords, const void *data)
     if (nrecords == 0)
         return SUCCEED;
 
+    /* Collect the packets in the append buffer, writing it out each time it
+     * fills, so the dataset is always extended by whole buffers */
+    if (table->append_nalloc > 0) {
+        const unsigned char *src = (const unsigned char *)data;
+        size_t               n;
+
+        while (nrecords > 0) {
+            if (table->append_nused == 0 && nrecords >= table->append_nalloc) {
+                /* Write whole buffers' worth of packets straight from the caller */
+                n = nrecords - nrecords % table->append_nalloc;
+                if (H5TB_common_append_records(table->dset_id, table->type_id, n, table->size, src) < 0)
+                    goto error;
+                table->size += n;
+            }
+            else {
+                n = table->append_nalloc - table->append_nused;
+                if (n > nrecords)
+                    n = nrecords;
+                HDmemcpy((unsigned char *)table->append_buf + table->append_nused * table->type_size, src,
+                         n * table->type_size);
+                table->append_nused += n;
+                table->size += n;
+                if (table->append_nused == table->append_nalloc)
+                    if (H5PT_flush_append_buf(table) < 0)
+                        goto error;
+            }
+            src += n * table->type_size;
+            nrecords -= n;
+        }
+
+        return SUCCEED;
+    }
+
     if ((H5TB_common_append_records(table->dset_id, table->type_id, nrecords, table->size, data)) < 0)
         goto error;
 
@@ -553,6 +672,185 @@ error:
     return FAIL;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: H5PTset_append_buffer
+ *
+ * Purpose: Sets the number of packets that H5PTappend collects in memory
+ *          before extending and writing the dataset.  The number is
+ *          rounded up to a multiple of the dataset's chunk size, so that
+ *          each batch covers whole chunks.  A size of 0 writes out any
+ *          buffered packets and turns buffering off.
+ *
+ * Return: Success: SUCCEED, Failure: FAIL
+ *
+ * Comments: Buffering is not allowed for packets containing
+ *           variable-length data or references, since those hold
+ *           pointers into memory the application may free after the
+ *           append returns.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PTset_append_buffer(hid_t table_id, size_t nrecords)
+{
+    htbl_t *table;
+    hid_t   dcpl_id = H5I_INVALID_HID;
+    hsize_t chunk_dims[1];
+    void *  new_buf;
+
+    /* Find the table struct from its ID */
+    if ((table = (htbl_t *)H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
+        goto error;
+
+    /* Write out the packets currently buffered */
+    if (H5PT_flush_append_buf(table) < 0)
+        goto error;
+
+    if (nrecords == 0) {
+        HDfree(table->append_buf);
+        table->append_buf    = NULL;
+        table->append_nalloc = 0;
+        return SUCCEED;
+    }
+
+    /* Packets holding pointers can't outlive the caller's buffer */
+    if (H5PT_has_vlen(table->type_id) != FALSE)
+        goto error;
+    if (H5Tdetect_class(table->type_id, H5T_REFERENCE) != FALSE)
+        goto error;
+
+    /* Round the buffer up to whole chunks */
+    if ((dcpl_id = H5Dget_create_plist(table->dset_id)) < 0)
+        goto error;
+    if (H5Pget_layout(dcpl_id) == H5D_CHUNKED) {
+        if (H5Pget_chunk(dcpl_id, 1, chunk_dims) < 0)
+            goto error;
+        if (chunk_dims[0] > 0 && nrecords % chunk_dims[0])
+            nrecords += (size_t)(chunk_dims[0] - nrecords % chunk_dims[0]);
+    }
+    if (H5Pclose(dcpl_id) < 0)
+        goto error;
+    dcpl_id = H5I_INVALID_HID;
+
+    if ((table->type_size = H5Tget_size(table->type_id)) == 0)
+        goto error;
+    if (nrecords > SIZE_MAX / table->type_size)
+        goto error;
+    if ((new_buf = HDrealloc(table->append_buf, nrecords * table->type_size)) == NULL)
+        goto error;
+    table->append_buf    = new_buf;
+    table->append_nalloc = nrecords;
+
+    return SUCCEED;
+
+error:
+    if (dcpl_id != H5I_INVALID_HID) {
+        H5E_BEGIN_TRY
+        H5Pclose(dcpl_id);
+        H5E_END_TRY
+    }
+    return FAIL;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PTflush
+ *
+ * Purpose: Writes out the packets held in a packet table's append buffer
+ *
+ * Return: Success: SUCCEED, Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PTflush(hid_t table_id)
+{
+    htbl_t *table;
+
+    /* Find the table struct from its ID */
+    if ((table = (htbl_t *)H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
+        return FAIL;
+
+    return H5PT_flush_append_buf(table);
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_flush_append_buf
+ *
+ * Purpose: Extends the dataset and writes the packets held in the append
+ *          buffer with a single H5Dwrite
+ *
+ * Return: Success: SUCCEED, Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PT_flush_append_buf(htbl_t *table)
+{
+    if (table->append_nused == 0)
+        return SUCCEED;
+
+    /* The buffered packets are already counted in the table size */
+    if (H5TB_common_append_records(table->dset_id, table->type_id, table->append_nused,
+                                   table->size - table->append_nused, table->append_buf) < 0)
+        return FAIL;
+
+    table->append_nused = 0;
+    return SUCCEED;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_has_vlen
+ *
+ * Purpose: Checks whether a datatype holds variable-length sequences or
+ *          strings, at the top level or inside compound members, arrays
+ *          and sequences
+ *
+ * Return: TRUE, FALSE or FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5PT_has_vlen(hid_t type_id)
+{
+    H5T_class_t tclass;
+    hid_t       member_id;
+    htri_t      ret_value = FALSE;
+
+    /* H5Tdetect_class already looks through members and base types for
+     * sequences, but reports variable-length strings as H5T_STRING */
+    if ((ret_value = H5Tdetect_class(type_id, H5T_VLEN)) != FALSE)
+        return ret_value;
+    if ((ret_value = H5Tis_variable_str(type_id)) != FALSE)
+        return ret_value;
+
+    if ((tclass = H5Tget_class(type_id)) == H5T_NO_CLASS)
+        return FAIL;
+
+    if (tclass == H5T_ARRAY) {
+        if ((member_id = H5Tget_super(type_id)) < 0)
+            return FAIL;
+        ret_value = H5PT_has_vlen(member_id);
+        if (H5Tclose(member_id) < 0)
+            return FAIL;
+    }
+    else if (tclass == H5T_COMPOUND) {
+        int      nmembs;
+        unsigned u;
+
+        if ((nmembs = H5Tget_nmembers(type_id)) < 0)
+            return FAIL;
+        for (u = 0; u < (unsigned)nmembs && ret_value == FALSE; u++) {
+            if ((member_id = H5Tget_member_type(type_id, u)) < 0)
+                return FAIL;
+            ret_value = H5PT_has_vlen(member_id);
+            if (H5Tclose(member_id) < 0)
+                return FAIL;
+        }
+    }
+
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  *
  * Read functions
@@ -593,6 +891,10 @@ H5PTget_next(hid_t table_id, size_t nrecords, void *data)
     if (nrecords == 0)
         return SUCCEED;
 
+    /* Make buffered packets visible to the read */
+    if (H5PT_flush_append_buf(table) < 0)
+        goto error;
+
     if ((H5TB_common_read_records(table->dset_id, table->type_id, table->current_index, nrecords, table->size,
                                   data)) < 0)
         goto error;
@@ -638,6 +940,10 @@ H5PTread_packets(hid_t table_id, hsize_t start, size_t nrecords, void *data)
     if (nrecords == 0)
         return SUCCEED;
 
+    /* Make buffered packets visible to the read */
+    if (H5PT_flush_append_buf(table) < 0)
+        goto error;
+
     if (H5TB_common_read_records(table->dset_id, table->type_id, start, nrecords, table->size, data) < 0)
         goto error;
 
@@ -972,6 +1278,10 @@ H5PTget_dataset(hid_t table_id)
     if ((table = (htbl_t *)H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
         goto error;
 
+    /* The caller may access the dataset directly, so write out buffered packets */
+    if (H5PT_flush_append_buf(table) < 0)
+        goto error;
+
     ret_value = table->dset_id;
 
 error:
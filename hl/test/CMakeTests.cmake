@@ -70,6 +70,7 @@ set (test_hl_CLEANFILES
     test_lite3.h5
     test_lite4.h5
     test_packet_compress.h5
+    test_packet_shutdown.h5
     test_packet_table.h5
     test_packet_table_vlen.h5
     testfl_packet_table_vlen.h5
@@ -26,6 +26,7 @@
 #define NFIELDS            5
 #define TEST_FILE_NAME     "test_packet_table.h5"
 #define TEST_COMPRESS_FILE "test_packet_compress.h5"
+#define TEST_SHUTDOWN_FILE "test_packet_shutdown.h5"
 #define PT_NAME            "Test Packet Table"
 #define H5TB_TABLE_NAME    "Table1"
 
@@ -498,6 +499,254 @@ error:
     return FAIL;
 }
 
+/*-------------------------------------------------------------------------
+ * test_append_buffer
+ *
+ * Tests that packets collected by an append buffer reach the dataset
+ * when the buffer fills, before reads, and when the table is closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_append_buffer(hid_t fid)
+{
+    herr_t      err;
+    hid_t       table = H5I_INVALID_HID;
+    hid_t       dset  = H5I_INVALID_HID;
+    hid_t       space = H5I_INVALID_HID;
+    hid_t       part_t;
+    hid_t       vlstr_t;
+    size_t      c;
+    particle_t  readPart;
+    particle_t *bigPart = NULL;
+    hsize_t     count;
+    hsize_t     dims[1];
+    hsize_t     array_dims[1] = {2};
+
+    HL_TESTING2("buffered packet table appends");
+
+    if ((bigPart = (particle_t *)HDmalloc(NRECORDS * 9 * sizeof(particle_t))) == NULL)
+        goto error;
+    for (c = 0; c < NRECORDS * 9; c++)
+        bigPart[c] = testPart[c % NRECORDS];
+
+    /* Create a datatype for the particle struct */
+    part_t = make_particle_type();
+
+    HDassert(part_t != -1);
+
+    /* Create a new table with a buffer that is rounded up to two chunks */
+    table = H5PTcreate(fid, "Packet Test Dataset Buffered", part_t, (hsize_t)33, H5P_DEFAULT);
+    if (H5Tclose(part_t) < 0)
+        goto error;
+    if (H5PTis_valid(table) < 0)
+        goto error;
+    if (H5PTset_append_buffer(table, (size_t)50) < 0)
+        goto error;
+
+    /* Add particles; they should not all reach the dataset yet */
+    for (c = 0; c < BIG_TABLE_SIZE / 2; c += 8)
+        if (H5PTappend(table, (size_t)8, &(testPart[0])) < 0)
+            goto error;
+    if ((dset = H5Dopen2(fid, "Packet Test Dataset Buffered", H5P_DEFAULT)) < 0)
+        goto error;
+    if ((space = H5Dget_space(dset)) < 0)
+        goto error;
+    if (H5Sget_simple_extent_dims(space, dims, NULL) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (dims[0] % 66 != 0 || dims[0] >= BIG_TABLE_SIZE / 2)
+        goto error;
+
+    /* A read must see every appended packet */
+    if (H5PTread_packets(table, (hsize_t)(BIG_TABLE_SIZE / 2 - 1), (size_t)1, &readPart) < 0)
+        goto error;
+    if (cmp_par(7, 0, testPart, &readPart) != 0)
+        goto error;
+
+    /* Add the rest, including a batch bigger than the buffer */
+    for (c = BIG_TABLE_SIZE / 2; c < BIG_TABLE_SIZE - NRECORDS * 9; c += 8)
+        if (H5PTappend(table, (size_t)8, &(testPart[0])) < 0)
+            goto error;
+    if (H5PTappend(table, (size_t)(NRECORDS * 9), bigPart) < 0)
+        goto error;
+
+    err = H5PTget_num_packets(table, &count);
+    if (err < 0)
+        goto error;
+    if (count != BIG_TABLE_SIZE)
+        goto error;
+
+    for (c = 0; c < BIG_TABLE_SIZE; c++) {
+        if (H5PTget_next(table, (size_t)1, &readPart) < 0)
+            goto error;
+        if (cmp_par(c % 8, 0, testPart, &readPart) != 0)
+            goto error;
+    }
+
+    /* Packets still buffered at close must be written */
+    if (H5PTappend(table, (size_t)8, &(testPart[0])) < 0)
+        goto error;
+    if (H5PTclose(table) < 0)
+        goto error;
+    if ((space = H5Dget_space(dset)) < 0)
+        goto error;
+    if (H5Sget_simple_extent_dims(space, dims, NULL) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (dims[0] != BIG_TABLE_SIZE + 8)
+        goto error;
+    if (H5Dclose(dset) < 0)
+        goto error;
+
+    /* Variable-length strings point into the caller's memory and can't be
+     * buffered */
+    if ((part_t = H5Tcopy(H5T_C_S1)) < 0)
+        goto error;
+    if (H5Tset_size(part_t, H5T_VARIABLE) < 0)
+        goto error;
+    table = H5PTcreate(fid, "Packet Test Dataset Buffered VL String", part_t, (hsize_t)33, H5P_DEFAULT);
+    if (H5Tclose(part_t) < 0)
+        goto error;
+    if (H5PTis_valid(table) < 0)
+        goto error;
+    H5E_BEGIN_TRY
+    {
+        err = H5PTset_append_buffer(table, (size_t)50);
+    }
+    H5E_END_TRY;
+    if (err >= 0)
+        goto error;
+    if (H5PTclose(table) < 0)
+        goto error;
+
+    /* The same goes for strings nested in an array */
+    if ((vlstr_t = H5Tcopy(H5T_C_S1)) < 0)
+        goto error;
+    if (H5Tset_size(vlstr_t, H5T_VARIABLE) < 0)
+        goto error;
+    if ((part_t = H5Tarray_create2(vlstr_t, 1, array_dims)) < 0)
+        goto error;
+    if (H5Tclose(vlstr_t) < 0)
+        goto error;
+    table = H5PTcreate(fid, "Packet Test Dataset Buffered VL String Array", part_t, (hsize_t)33, H5P_DEFAULT);
+    if (H5Tclose(part_t) < 0)
+        goto error;
+    if (H5PTis_valid(table) < 0)
+        goto error;
+    H5E_BEGIN_TRY
+    {
+        err = H5PTset_append_buffer(table, (size_t)50);
+    }
+    H5E_END_TRY;
+    if (err >= 0)
+        goto error;
+    if (H5PTclose(table) < 0)
+        goto error;
+
+    HDfree(bigPart);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5_FAILED();
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+    }
+    H5E_END_TRY;
+    if (H5PTis_valid(table) > 0)
+        H5PTclose(table);
+    HDfree(bigPart);
+    return FAIL;
+}
+
+/*-------------------------------------------------------------------------
+ * test_append_buffer_shutdown
+ *
+ * Tests that packets still held in an append buffer are written when the
+ * library shuts down with the packet table open.  Closes the library, so
+ * it must run after the other tests have closed their files.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_append_buffer_shutdown(void)
+{
+    hid_t      fid   = H5I_INVALID_HID;
+    hid_t      table = H5I_INVALID_HID;
+    hid_t      part_t;
+    size_t     c;
+    particle_t readPart;
+    hsize_t    count;
+
+    HL_TESTING2("buffered packet table appends at library close");
+
+    if ((fid = H5Fcreate(TEST_SHUTDOWN_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Create a datatype for the particle struct */
+    part_t = make_particle_type();
+
+    HDassert(part_t != -1);
+
+    table = H5PTcreate(fid, "Packet Test Dataset Shutdown", part_t, (hsize_t)33, H5P_DEFAULT);
+    if (H5Tclose(part_t) < 0)
+        goto error;
+    if (H5PTis_valid(table) < 0)
+        goto error;
+    if (H5PTset_append_buffer(table, (size_t)50) < 0)
+        goto error;
+
+    /* Leave packets in the buffer and close the library without closing
+     * or flushing the table */
+    for (c = 0; c < 3; c++)
+        if (H5PTappend(table, (size_t)8, &(testPart[0])) < 0)
+            goto error;
+    if (H5Fclose(fid) < 0)
+        goto error;
+    fid = H5I_INVALID_HID;
+    if (H5close() < 0)
+        goto error;
+
+    /* Every packet must be in the file */
+    if ((fid = H5Fopen(TEST_SHUTDOWN_FILE, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        goto error;
+    if ((table = H5PTopen(fid, "Packet Test Dataset Shutdown")) < 0)
+        goto error;
+    if (H5PTget_num_packets(table, &count) < 0)
+        goto error;
+    if (count != 3 * NRECORDS)
+        goto error;
+    for (c = 0; c < 3 * NRECORDS; c++) {
+        if (H5PTget_next(table, (size_t)1, &readPart) < 0)
+            goto error;
+        if (cmp_par(c % 8, 0, testPart, &readPart) != 0)
+            goto error;
+    }
+    if (H5PTclose(table) < 0)
+        goto error;
+    if (H5Fclose(fid) < 0)
+        goto error;
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5_FAILED();
+    if (H5PTis_valid(table) > 0)
+        H5PTclose(table);
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+}
+
 /*-------------------------------------------------------------------------
  * test_opaque
  *
@@ -957,6 +1206,7 @@ test_packet_table(hid_t fid)
     test_read(fid);
     test_get_next(fid);
     test_big_table(fid);
+    test_append_buffer(fid);
     test_rw_nonnative_dt(fid);
     test_opaque(fid);
     test_compress();
@@ -997,5 +1247,9 @@ main(void)
     if (H5Fclose(fid) < 0)
         status = 1;
 
+    /* Test that buffered packets survive library shutdown */
+    if (test_append_buffer_shutdown() < 0)
+        status = 1;
+
     return status;
 }
@@ -27,6 +27,7 @@
 #include "H5FLprivate.h" /* Free Lists                           */
 #include "H5Iprivate.h"  /* IDs                                  */
 #include "H5MMprivate.h" /* Memory management			*/
+#include "H5VMprivate.h" /* Vectors and arrays                   */
 
 /****************/
 /* Local Macros */
@@ -280,6 +281,7 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, vo
     size_t         curr_len;            /* Length of bytes left to process in sequence */
     size_t         nseq;                /* Number of sequences generated */
     size_t         curr_seq;            /* Current sequence being processed */
+    size_t         nrun;                /* Number of sequences with the current length */
     size_t         nelem;               /* Number of elements used in sequences */
     size_t         dxpl_vec_size;       /* Vector length from API context's DXPL */
     size_t         vec_size;            /* Vector length */
@@ -314,15 +316,23 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, vo
             HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed")
 
         /* Loop, while sequences left to process */
-        for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
+        curr_seq = 0;
+        while (curr_seq < nseq) {
             /* Get the number of bytes in sequence */
             curr_len = len[curr_seq];
 
-            H5MM_memcpy(buf + off[curr_seq], tscat_buf, curr_len);
+            /* Find the run of sequences with this length */
+            nrun = 1;
+            while (curr_seq + nrun < nseq && len[curr_seq + nrun] == curr_len)
+                nrun++;
+
+            /* Copy the run into the destination buffer */
+            H5VM_memcpy_seq_run(buf, off + curr_seq, tscat_buf, NULL, nrun, curr_len);
 
-            /* Advance offset in destination buffer */
-            tscat_buf += curr_len;
-        } /* end for */
+            /* Advance offset in scatter buffer */
+            tscat_buf += nrun * curr_len;
+            curr_seq += nrun;
+        } /* end while */
 
         /* Decrement number of elements left to process */
         nelmts -= nelem;
@@ -365,6 +375,7 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tg
     size_t         curr_len;           /* Length of bytes left to process in sequence */
     size_t         nseq;               /* Number of sequences generated */
     size_t         curr_seq;           /* Current sequence being processed */
+    size_t         nrun;               /* Number of sequences with the current length */
     size_t         nelem;              /* Number of elements used in sequences */
     size_t         dxpl_vec_size;      /* Vector length from API context's DXPL */
     size_t         vec_size;           /* Vector length */
@@ -399,15 +410,23 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tg
             HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed")
 
         /* Loop, while sequences left to process */
-        for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
+        curr_seq = 0;
+        while (curr_seq < nseq) {
             /* Get the number of bytes in sequence */
             curr_len = len[curr_seq];
 
-            H5MM_memcpy(tgath_buf, buf + off[curr_seq], curr_len);
+            /* Find the run of sequences with this length */
+            nrun = 1;
+            while (curr_seq + nrun < nseq && len[curr_seq + nrun] == curr_len)
+                nrun++;
+
+            /* Copy the run into the gather buffer */
+            H5VM_memcpy_seq_run(tgath_buf, NULL, buf, off + curr_seq, nrun, curr_len);
 
             /* Advance offset in gather buffer */
-            tgath_buf += curr_len;
-        } /* end for */
+            tgath_buf += nrun * curr_len;
+            curr_seq += nrun;
+        } /* end while */
 
         /* Decrement number of elements left to process */
         nelmts -= nelem;
@@ -759,7 +778,8 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
     HDassert(type_info);
     HDassert(type_info->cmpd_subset);
     HDassert(H5T_SUBSET_SRC == type_info->cmpd_subset->subset ||
-             H5T_SUBSET_DST == type_info->cmpd_subset->subset);
+             H5T_SUBSET_DST == type_info->cmpd_subset->subset ||
+             H5T_SUBSET_DST_MEMBS == type_info->cmpd_subset->subset);
     HDassert(user_buf);
 
     /* Get info from API context */
@@ -812,13 +832,28 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
             xubuf       = ubuf + curr_off;
 
             /* Copy the data into the right place. */
-            for (i = 0; i < curr_nelmts; i++) {
-                HDmemmove(xubuf, xdbuf, copy_size);
-
-                /* Update pointers */
-                xdbuf += src_stride;
-                xubuf += dst_stride;
-            } /* end for */
+            if (H5T_SUBSET_DST_MEMBS == type_info->cmpd_subset->subset) {
+                const H5T_subset_run_t *runs  = type_info->cmpd_subset->runs;
+                size_t                  nruns = type_info->cmpd_subset->nruns;
+                size_t                  u;
+
+                for (i = 0; i < curr_nelmts; i++) {
+                    for (u = 0; u < nruns; u++)
+                        H5MM_memcpy(xubuf + runs[u].dst_offset, xdbuf + runs[u].src_offset, runs[u].size);
+
+                    /* Update pointers */
+                    xdbuf += src_stride;
+                    xubuf += dst_stride;
+                } /* end for */
+            }     /* end if */
+            else
+                for (i = 0; i < curr_nelmts; i++) {
+                    HDmemmove(xubuf, xdbuf, copy_size);
+
+                    /* Update pointers */
+                    xdbuf += src_stride;
+                    xubuf += dst_stride;
+                } /* end for */
         }     /* end for */
 
         /* Decrement number of elements left to process */
@@ -105,7 +105,7 @@ static herr_t H5D__virtual_build_source_name(char *
 static herr_t H5D__virtual_init_all(const H5D_t *dset);
 static herr_t H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage,
                                   const H5S_t *file_space, const H5S_t *mem_space, hsize_t *tot_nelmts);
-static herr_t H5D__virtual_post_io(H5O_storage_virtual_t *storage);
+static herr_t H5D__virtual_post_io(const H5D_t *dset, H5O_storage_virtual_t *storage);
 static herr_t H5D__virtual_read_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                                     const H5S_t *file_space, H5O_storage_virtual_srcdset_t *source_dset);
 static herr_t H5D__virtual_write_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
@@ -2385,6 +2385,7 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
     hsize_t  bounds_end[H5S_MAX_RANK];   /* Selection bounds end */
     int      rank        = 0;
     hbool_t  bounds_init = FALSE; /* Whether bounds_start, bounds_end, and rank are valid */
+    htri_t   intersect;           /* Whether a mapping overlaps the file selection's bounds */
     size_t   i, j, k;             /* Local index variables */
     herr_t   ret_value = SUCCEED; /* Return value */
 
@@ -2404,6 +2405,21 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
     /* Initialize tot_nelmts */
     *tot_nelmts = 0;
 
+    /* Get the bounds of the file selection, so that mappings which can't
+     * overlap it are skipped without projecting their selections */
+    if (storage->list_nused > 0 && H5S_SEL_NONE != H5S_GET_SELECT_TYPE(file_space)) {
+        /* Get rank of VDS */
+        if ((rank = H5S_GET_EXTENT_NDIMS(io_info->dset->shared->space)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get number of dimensions")
+
+        /* Get selection bounds */
+        if (H5S_SELECT_BOUNDS(file_space, bounds_start, bounds_end) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+
+        /* Bounds are now initialized */
+        bounds_init = TRUE;
+    } /* end if */
+
     /* Iterate over mappings */
     for (i = 0; i < storage->list_nused; i++) {
         /* Sanity check that the virtual space has been patched by now */
@@ -2425,11 +2441,6 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                 if (H5S_SELECT_BOUNDS(file_space, bounds_start, bounds_end) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
 
-                /* Adjust bounds_end to represent the extent just enclosing them
-                 * (add 1) */
-                for (j = 0; j < (size_t)rank; j++)
-                    bounds_end[j]++;
-
                 /* Bounds are now initialized */
                 bounds_init = TRUE;
             } /* end if */
@@ -2440,9 +2451,10 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                                                       bounds_start[storage->list[i].unlim_dim_virtual], NULL);
 
             /* Get index of first block outside of virtual selection */
+            /* (Add 1 to the bounds' end, to get the extent just enclosing them) */
             storage->list[i].sub_dset_io_end = (size_t)H5S_hyper_get_first_inc_block(
-                storage->list[i].source_dset.virtual_select, bounds_end[storage->list[i].unlim_dim_virtual],
-                &partial_block);
+                storage->list[i].source_dset.virtual_select,
+                bounds_end[storage->list[i].unlim_dim_virtual] + 1, &partial_block);
             if (partial_block)
                 storage->list[i].sub_dset_io_end++;
             if (storage->list[i].sub_dset_io_end > storage->list[i].sub_dset_nused)
@@ -2524,8 +2536,16 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                 }     /* end if */
 
                 /* Only continue if we managed to obtain a
-                 * clipped_virtual_select */
-                if (storage->list[i].sub_dset[j].clipped_virtual_select) {
+                 * clipped_virtual_select that overlaps the file selection's
+                 * bounds */
+                intersect = FALSE;
+                if (storage->list[i].sub_dset[j].clipped_virtual_select)
+                    if ((intersect = H5S_SELECT_INTERSECT_BLOCK(
+                             storage->list[i].sub_dset[j].clipped_virtual_select, bounds_start, bounds_end)) <
+                        0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL,
+                                    "can't check for intersection with file selection")
+                if (intersect) {
                     /* Project intersection of file space and mapping virtual space
                      * onto memory space */
                     if (H5S_select_project_intersection(
@@ -2570,7 +2590,19 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
             }     /* end for */
         }         /* end if */
         else {
+            /* Check if the mapping overlaps the file selection's bounds */
+            intersect = FALSE;
             if (storage->list[i].source_dset.clipped_virtual_select) {
+                if (!bounds_init)
+                    intersect = TRUE;
+                else if ((intersect = H5S_SELECT_INTERSECT_BLOCK(
+                              storage->list[i].source_dset.clipped_virtual_select, bounds_start, bounds_end)) <
+                         0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL,
+                                "can't check for intersection with file selection")
+            } /* end if */
+
+            if (intersect) {
                 /* Project intersection of file space and mapping virtual space onto
                  * memory space */
                 if (H5S_select_project_intersection(
@@ -2610,7 +2642,7 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                 else
                     *tot_nelmts += (hsize_t)select_nelmts;
             } /* end if */
-            else {
+            else if (!storage->list[i].source_dset.clipped_virtual_select) {
                 /* If there is no clipped_dim_virtual, this must be an unlimited
                  * selection whose dataset was not found in the last call to
                  * H5Dget_space().  Do not attempt to open it as this might
@@ -2631,6 +2663,13 @@ done:
  *
  * Purpose:     Frees memory structures allocated by H5D__virtual_pre_io.
  *
+ *              If the virtual dataset's file has an external file cache,
+ *              the number of source datasets kept open is bounded by the
+ *              size of that cache: when there are more open than the
+ *              cache can hold, the source datasets that did not take
+ *              part in this I/O are closed.  They are reopened (through
+ *              the cache) when next needed.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Neil Fortner
@@ -2639,16 +2678,54 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__virtual_post_io(H5O_storage_virtual_t *storage)
+H5D__virtual_post_io(const H5D_t *dset, H5O_storage_virtual_t *storage)
 {
-    size_t i, j;                /* Local index variables */
-    herr_t ret_value = SUCCEED; /* Return value */
+    unsigned max_open;            /* Maximum number of source datasets to keep open */
+    size_t   nopen     = 0;       /* Number of open source datasets */
+    size_t   i, j;                /* Local index variables */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
+    HDassert(dset);
     HDassert(storage);
 
+    /* Count open source datasets, if they are bounded */
+    if ((max_open = H5F_get_efc_max_nfiles(dset->oloc.file)) > 0) {
+        for (i = 0; i < storage->list_nused; i++) {
+            if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
+                for (j = 0; j < storage->list[i].sub_dset_nused; j++)
+                    if (storage->list[i].sub_dset[j].dset)
+                        nopen++;
+            } /* end if */
+            else if (storage->list[i].source_dset.dset)
+                nopen++;
+        } /* end for */
+    }     /* end if */
+
+    /* Close source datasets that were not used by this I/O operation if there
+     * are more open than the external file cache can hold */
+    if (nopen > (size_t)max_open) {
+        for (i = 0; i < storage->list_nused; i++) {
+            if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
+                for (j = 0; j < storage->list[i].sub_dset_nused; j++)
+                    if (storage->list[i].sub_dset[j].dset &&
+                        !storage->list[i].sub_dset[j].projected_mem_space) {
+                        if (H5D_close(storage->list[i].sub_dset[j].dset) < 0)
+                            HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to close source dataset")
+                        storage->list[i].sub_dset[j].dset = NULL;
+                    } /* end if */
+            }         /* end if */
+            else if (storage->list[i].source_dset.dset &&
+                     !storage->list[i].source_dset.projected_mem_space) {
+                if (H5D_close(storage->list[i].source_dset.dset) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to close source dataset")
+                storage->list[i].source_dset.dset = NULL;
+            } /* end if */
+        }     /* end for */
+    }         /* end if */
+
     /* Iterate over mappings */
     for (i = 0; i < storage->list_nused; i++)
         /* Check for "printf" source dataset resolution */
@@ -2854,7 +2931,7 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
 
 done:
     /* Cleanup I/O operation */
-    if (H5D__virtual_post_io(storage) < 0)
+    if (H5D__virtual_post_io(io_info->dset, storage) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't cleanup I/O operation")
 
     /* Close fill space */
@@ -2996,7 +3073,7 @@ H5D__virtual_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsi
 
 done:
     /* Cleanup I/O operation */
-    if (H5D__virtual_post_io(storage) < 0)
+    if (H5D__virtual_post_io(io_info->dset, storage) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't cleanup I/O operation")
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -132,6 +132,7 @@ H5FS__sinfo_new(H5F_t *f, H5FS_t *fspace)
 
     /* Set non-zero values */
     sinfo->nbins            = H5VM_log2_gen(fspace->max_sect_size);
+    HDassert(sinfo->nbins <= 64);
     sinfo->sect_prefix_size = H5FS_SINFO_PREFIX_SIZE(f);
     sinfo->sect_off_size    = (fspace->max_sect_addr + 7) / 8;
     sinfo->sect_len_size    = H5VM_limit_enc_size((uint64_t)fspace->max_sect_size);
@@ -697,6 +698,8 @@ H5FS__size_node_decr(H5FS_sinfo_t *sinfo, unsigned bin, H5FS_node_t *fspace_node
      *  the bin's skiplist is also a skiplist...)
      */
     sinfo->bins[bin].tot_sect_count--;
+    if (sinfo->bins[bin].tot_sect_count == 0)
+        sinfo->bin_mask &= ~((uint64_t)1 << bin);
 
     /* Check for 'ghost' or 'serializable' section */
     if (cls->flags & H5FS_CLS_GHOST_OBJ) {
@@ -999,6 +1002,7 @@ H5FS__sect_link_size(H5FS_sinfo_t *sinfo, const H5FS_section_class_t *cls, H5FS_
      *  the bin's skiplist is also a skiplist...)
      */
     sinfo->bins[bin].tot_sect_count++;
+    sinfo->bin_mask |= ((uint64_t)1 << bin);
     if (cls->flags & H5FS_CLS_GHOST_OBJ) {
         sinfo->bins[bin].ghost_sect_count++;
         fspace_node->ghost_count++;
@@ -1627,6 +1631,7 @@ H5FS__sect_find_node(H5FS_t *fspace, hsize_t request, H5FS_section_info_t **node
 {
     H5FS_node_t *fspace_node;       /* Free list size node */
     unsigned     bin;               /* Bin to put the free space section in */
+    uint64_t     bin_mask;          /* Bins left to search */
     htri_t       ret_value = FALSE; /* Return value */
 
     H5SL_node_t *               curr_size_node = NULL;
@@ -1649,114 +1654,120 @@ H5FS__sect_find_node(H5FS_t *fspace, hsize_t request, H5FS_section_info_t **node
     if (!((alignment > 1) && (request >= fspace->align_thres)))
         alignment = 0; /* no alignment */
 
-    do {
-        /* Check if there's any sections in this bin */
-        if (fspace->sinfo->bins[bin].bin_list) {
-
-            if (!alignment) { /* no alignment */
-                /* Find the first free space section that is large enough to fulfill request */
-                /* (Since the bins use skip lists to track the sizes of the address-ordered
-                 *  lists, this is actually a "best fit" algorithm)
-                 */
-                /* Look for large enough free space section in this bin */
-                if ((fspace_node =
-                         (H5FS_node_t *)H5SL_greater(fspace->sinfo->bins[bin].bin_list, &request))) {
-                    /* Take first node off of the list (ie. node w/lowest address) */
-                    if (NULL == (*node = (H5FS_section_info_t *)H5SL_remove_first(fspace_node->sect_list)))
-                        HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
-                                    "can't remove free space node from skip list")
-
-                    /* Get section's class */
-                    cls = &fspace->sect_cls[(*node)->type];
-                    /* Decrement # of sections in section size node */
-                    if (H5FS__size_node_decr(fspace->sinfo, bin, fspace_node, cls) < 0)
-                        HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
-                                    "can't remove free space size node from skip list")
-                    if (H5FS__sect_unlink_rest(fspace, cls, *node) < 0)
-                        HGOTO_ERROR(H5E_FSPACE, H5E_CANTFREE, FAIL,
-                                    "can't remove section from non-size tracking data structures")
-                    /* Indicate that we found a node for the request */
-                    HGOTO_DONE(TRUE)
-                }  /* end if */
-            }      /* end if */
-            else { /* alignment is set */
-                /* get the first node of a certain size in this bin */
-                curr_size_node = H5SL_first(fspace->sinfo->bins[bin].bin_list);
-                while (curr_size_node != NULL) {
-                    H5FS_node_t *curr_fspace_node = NULL;
-                    H5SL_node_t *curr_sect_node   = NULL;
-
-                    /* Get the free space node for free space sections of the same size */
-                    curr_fspace_node = (H5FS_node_t *)H5SL_item(curr_size_node);
+    /* Only visit the non-empty bins, starting from the request's bin */
+    bin_mask = fspace->sinfo->bin_mask & ~(((uint64_t)1 << bin) - 1);
+    while (bin_mask) {
+        /* Get the lowest non-empty bin left & drop it from the mask */
+        bin = H5VM_log2_gen(bin_mask & (~bin_mask + 1));
+        bin_mask &= (bin_mask - 1);
+        HDassert(bin < fspace->sinfo->nbins);
 
-                    /* Get the Skip list which holds  pointers to actual free list sections */
-                    curr_sect_node = (H5SL_node_t *)H5SL_first(curr_fspace_node->sect_list);
+        /* (Bins in the mask always have sections) */
+        HDassert(fspace->sinfo->bins[bin].bin_list);
+        HDassert(fspace->sinfo->bins[bin].tot_sect_count > 0);
 
-                    while (curr_sect_node != NULL) {
-                        H5FS_section_info_t *curr_sect = NULL;
-                        hsize_t              mis_align = 0, frag_size = 0;
-                        H5FS_section_info_t *split_sect = NULL;
-
-                        /* Get section node */
-                        curr_sect = (H5FS_section_info_t *)H5SL_item(curr_sect_node);
-
-                        HDassert(H5F_addr_defined(curr_sect->addr));
-                        HDassert(curr_fspace_node->sect_size == curr_sect->size);
-
-                        cls = &fspace->sect_cls[curr_sect->type];
-
-                        HDassert(alignment);
-                        HDassert(cls);
-
-                        if ((mis_align = curr_sect->addr % alignment))
-                            frag_size = alignment - mis_align;
-
-                        if ((curr_sect->size >= (request + frag_size)) && (cls->split)) {
-                            /* remove the section with aligned address */
-                            if (NULL == (*node = (H5FS_section_info_t *)H5SL_remove(
-                                             curr_fspace_node->sect_list, &curr_sect->addr)))
-                                HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
-                                            "can't remove free space node from skip list")
-                            /* Decrement # of sections in section size node */
-                            if (H5FS__size_node_decr(fspace->sinfo, bin, curr_fspace_node, cls) < 0)
-                                HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
-                                            "can't remove free space size node from skip list")
-
-                            if (H5FS__sect_unlink_rest(fspace, cls, *node) < 0)
-                                HGOTO_ERROR(H5E_FSPACE, H5E_CANTFREE, FAIL,
-                                            "can't remove section from non-size tracking data structures")
-
-                            /*
-                             * The split() callback splits NODE into 2 sections:
-                             *  split_sect is the unused fragment for aligning NODE
-                             *  NODE's addr & size are updated to point to the remaining aligned section
-                             * split_sect is re-added to free-space
-                             */
-                            if (mis_align) {
-                                split_sect = cls->split(*node, frag_size);
-                                if ((H5FS__sect_link(fspace, split_sect, 0) < 0))
-                                    HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL,
-                                                "can't insert free space section into skip list")
-                                /* sanity check */
-                                HDassert(split_sect->addr < (*node)->addr);
-                                HDassert(request <= (*node)->size);
-                            } /* end if */
-                            /* Indicate that we found a node for the request */
-                            HGOTO_DONE(TRUE)
+        if (!alignment) { /* no alignment */
+            /* Find the first free space section that is large enough to fulfill request */
+            /* (Since the bins use skip lists to track the sizes of the address-ordered
+             *  lists, this is actually a "best fit" algorithm)
+             */
+            /* Look for large enough free space section in this bin */
+            if ((fspace_node =
+                     (H5FS_node_t *)H5SL_greater(fspace->sinfo->bins[bin].bin_list, &request))) {
+                /* Take first node off of the list (ie. node w/lowest address) */
+                if (NULL == (*node = (H5FS_section_info_t *)H5SL_remove_first(fspace_node->sect_list)))
+                    HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
+                                "can't remove free space node from skip list")
+
+                /* Get section's class */
+                cls = &fspace->sect_cls[(*node)->type];
+                /* Decrement # of sections in section size node */
+                if (H5FS__size_node_decr(fspace->sinfo, bin, fspace_node, cls) < 0)
+                    HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
+                                "can't remove free space size node from skip list")
+                if (H5FS__sect_unlink_rest(fspace, cls, *node) < 0)
+                    HGOTO_ERROR(H5E_FSPACE, H5E_CANTFREE, FAIL,
+                                "can't remove section from non-size tracking data structures")
+                /* Indicate that we found a node for the request */
+                HGOTO_DONE(TRUE)
+            }  /* end if */
+        }      /* end if */
+        else { /* alignment is set */
+            /* get the first node in this bin that is at least as large as the request */
+            /* (smaller sections can't fulfill the request, whatever their alignment) */
+            curr_size_node = H5SL_above(fspace->sinfo->bins[bin].bin_list, &request);
+            while (curr_size_node != NULL) {
+                H5FS_node_t *curr_fspace_node = NULL;
+                H5SL_node_t *curr_sect_node   = NULL;
+
+                /* Get the free space node for free space sections of the same size */
+                curr_fspace_node = (H5FS_node_t *)H5SL_item(curr_size_node);
+
+                /* Get the Skip list which holds  pointers to actual free list sections */
+                curr_sect_node = (H5SL_node_t *)H5SL_first(curr_fspace_node->sect_list);
+
+                while (curr_sect_node != NULL) {
+                    H5FS_section_info_t *curr_sect = NULL;
+                    hsize_t              mis_align = 0, frag_size = 0;
+                    H5FS_section_info_t *split_sect = NULL;
+
+                    /* Get section node */
+                    curr_sect = (H5FS_section_info_t *)H5SL_item(curr_sect_node);
+
+                    HDassert(H5F_addr_defined(curr_sect->addr));
+                    HDassert(curr_fspace_node->sect_size == curr_sect->size);
+
+                    cls = &fspace->sect_cls[curr_sect->type];
+
+                    HDassert(alignment);
+                    HDassert(cls);
+
+                    if ((mis_align = curr_sect->addr % alignment))
+                        frag_size = alignment - mis_align;
+
+                    if ((curr_sect->size >= (request + frag_size)) && (cls->split)) {
+                        /* remove the section with aligned address */
+                        if (NULL == (*node = (H5FS_section_info_t *)H5SL_remove(
+                                         curr_fspace_node->sect_list, &curr_sect->addr)))
+                            HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
+                                        "can't remove free space node from skip list")
+                        /* Decrement # of sections in section size node */
+                        if (H5FS__size_node_decr(fspace->sinfo, bin, curr_fspace_node, cls) < 0)
+                            HGOTO_ERROR(H5E_FSPACE, H5E_CANTREMOVE, FAIL,
+                                        "can't remove free space size node from skip list")
+
+                        if (H5FS__sect_unlink_rest(fspace, cls, *node) < 0)
+                            HGOTO_ERROR(H5E_FSPACE, H5E_CANTFREE, FAIL,
+                                        "can't remove section from non-size tracking data structures")
+
+                        /*
+                         * The split() callback splits NODE into 2 sections:
+                         *  split_sect is the unused fragment for aligning NODE
+                         *  NODE's addr & size are updated to point to the remaining aligned section
+                         * split_sect is re-added to free-space
+                         */
+                        if (mis_align) {
+                            split_sect = cls->split(*node, frag_size);
+                            if ((H5FS__sect_link(fspace, split_sect, 0) < 0))
+                                HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL,
+                                            "can't insert free space section into skip list")
+                            /* sanity check */
+                            HDassert(split_sect->addr < (*node)->addr);
+                            HDassert(request <= (*node)->size);
                         } /* end if */
+                        /* Indicate that we found a node for the request */
+                        HGOTO_DONE(TRUE)
+                    } /* end if */
 
-                        /* Get the next section node in the list */
-                        curr_sect_node = H5SL_next(curr_sect_node);
-                    } /* end while of curr_sect_node */
+                    /* Get the next section node in the list */
+                    curr_sect_node = H5SL_next(curr_sect_node);
+                } /* end while of curr_sect_node */
 
-                    /* Get the next size node in the bin */
-                    curr_size_node = H5SL_next(curr_size_node);
-                } /* end while of curr_size_node */
-            }     /* else of alignment */
-        }         /* if bin_list */
-        /* Advance to next larger bin */
-        bin++;
-    } while (bin < fspace->sinfo->nbins);
+                /* Get the next size node in the bin */
+                curr_size_node = H5SL_next(curr_size_node);
+            } /* end while of curr_size_node */
+        }     /* else of alignment */
+    } /* end while */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2173,6 +2184,8 @@ H5FS__sect_assert(const H5FS_t *fspace)
         acc_ghost_size_count  = 0;
         for (u = 0; u < fspace->sinfo->nbins; u++) {
             acc_tot_sect_count += fspace->sinfo->bins[u].tot_sect_count;
+            HDassert((hbool_t)((fspace->sinfo->bin_mask >> u) & 1) ==
+                     (fspace->sinfo->bins[u].tot_sect_count > 0));
             acc_serial_sect_count += fspace->sinfo->bins[u].serial_sect_count;
             acc_ghost_sect_count += fspace->sinfo->bins[u].ghost_sect_count;
             if (fspace->sinfo->bins[u].bin_list) {
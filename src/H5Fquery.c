@@ -1319,3 +1319,30 @@ H5F_get_file_locking(const H5F_t *f)
 
     FUNC_LEAVE_NOAPI(f->shared->use_file_locking)
 } /* end H5F_get_file_locking */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_get_efc_max_nfiles
+ *
+ * Purpose:  Get the maximum number of files in the file's external
+ *           file cache
+ *
+ * Return:   Maximum number of cached files, or 0 if the file has no
+ *           external file cache
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_get_efc_max_nfiles(const H5F_t *f)
+{
+    unsigned ret_value = 0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if (f->shared->efc)
+        ret_value = H5F__efc_max_nfiles(f->shared->efc);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_get_efc_max_nfiles */
@@ -210,3 +210,26 @@ H5F__sfile_remove(H5F_shared_t *shared)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__sfile_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__sfile_count
+ *
+ * Purpose:     Count the "shared" file structs in the list of open files
+ *
+ * Return:      Number of open shared files (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F__sfile_count(void)
+{
+    H5F_sfile_node_t *curr;          /* Current shared file node */
+    unsigned          ret_value = 0; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    for (curr = H5F_sfile_head_g; curr; curr = curr->next)
+        ret_value++;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__sfile_count() */
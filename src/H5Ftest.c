@@ -285,3 +285,26 @@ H5F__reparse_file_lock_variable_test(void)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__reparse_file_lock_variable_test() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__get_nopen_files_test
+ *
+ * Purpose:     Retrieve the number of files the library has open, including
+ *              those opened internally without an ID (e.g. through the
+ *              external file cache)
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__get_nopen_files_test(unsigned *nfiles)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(nfiles);
+
+    *nfiles = H5F__sfile_count();
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F__get_nopen_files_test() */
@@ -1072,6 +1072,12 @@ done:
  *
  * Purpose:	Look up a link in a group, using the name as the key.
  *
+ *              This is on the path of every traversal step, so the link
+ *              info message is read directly from the object header
+ *              (protected only once) instead of through
+ *              H5G__obj_get_linfo(), which also counts the links in the
+ *              group, a value that isn't needed here.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Quincey Koziol
@@ -1082,6 +1088,7 @@ done:
 herr_t
 H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, hbool_t *found, H5O_link_t *lnk)
 {
+    H5O_t *     oh = NULL;           /* Group's object header */
     H5O_linfo_t linfo;               /* Link info message */
     htri_t      linfo_exists;        /* Whether the link info message exists */
     herr_t      ret_value = SUCCEED; /* Return value */
@@ -1092,9 +1099,21 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, hbool_t *found, H5O
     HDassert(grp_oloc && grp_oloc->file);
     HDassert(name && *name);
 
+    /* Protect the group's object header */
+    if (NULL == (oh = H5O_protect(grp_oloc, H5AC__READ_ONLY_FLAG, FALSE)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTPROTECT, FAIL, "unable to protect group object header")
+
     /* Attempt to get the link info message for this group */
-    if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
+    if ((linfo_exists = H5O_msg_exists_oh(oh, H5O_LINFO_ID)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+    if (linfo_exists && NULL == H5O_msg_read_oh(grp_oloc->file, oh, H5O_LINFO_ID, &linfo))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get link info message")
+
+    /* Release the object header before looking in the link storage */
+    if (H5O_unprotect(grp_oloc, oh, H5AC__NO_FLAGS_SET) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTUNPROTECT, FAIL, "unable to release group object header")
+    oh = NULL;
+
     if (linfo_exists) {
         /* Check for dense link storage */
         if (H5F_addr_defined(linfo.fheap_addr)) {
@@ -1114,6 +1133,9 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, hbool_t *found, H5O
         HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't locate object")
 
 done:
+    if (oh && H5O_unprotect(grp_oloc, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTUNPROTECT, FAIL, "unable to release group object header")
+
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G__obj_lookup() */
 
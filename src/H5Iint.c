@@ -195,7 +195,7 @@ H5I_register_type(const H5I_class_t *cls)
         type_info->cls          = cls;
         type_info->id_count     = 0;
         type_info->nextid       = cls->reserved;
-        type_info->last_id_info = NULL;
+        HDmemset(type_info->lookup_cache, 0, sizeof(type_info->lookup_cache));
         if (NULL == (type_info->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
             HGOTO_ERROR(H5E_ID, H5E_CANTCREATE, FAIL, "skip list creation failed")
     }
@@ -418,6 +418,10 @@ H5I__clear_type_cb(void *_info, void H5_ATTR_UNUSED *key, void *_udata)
 
         /* Remove ID if requested */
         if (ret_value) {
+            /* Check if this ID is in the lookup cache */
+            if (udata->type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(info->id)] == info)
+                udata->type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(info->id)] = NULL;
+
             /* Free ID info */
             info = H5FL_FREE(H5I_id_info_t, info);
 
@@ -541,8 +545,8 @@ H5I__register(H5I_type_t type, const void *object, hbool_t app_ref, H5I_future_r
     /* Sanity check for the 'nextid' getting too large and wrapping around */
     HDassert(type_info->nextid <= ID_MASK);
 
-    /* Set the most recent ID to this object */
-    type_info->last_id_info = info;
+    /* Cache the new ID's info */
+    type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(new_id)] = info;
 
     /* Set return value */
     ret_value = new_id;
@@ -649,8 +653,8 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, h
         HGOTO_ERROR(H5E_ID, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
     type_info->id_count++;
 
-    /* Set the most recent ID to this object */
-    type_info->last_id_info = info;
+    /* Cache the new ID's info */
+    type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(existing_id)] = info;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -904,9 +908,9 @@ H5I__remove_common(H5I_type_info_t *type_info, hid_t id)
     if (NULL == (info = (H5I_id_info_t *)H5SL_remove(type_info->ids, &id)))
         HGOTO_ERROR(H5E_ID, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
 
-    /* Check if this ID was the last one accessed */
-    if (type_info->last_id_info == info)
-        type_info->last_id_info = NULL;
+    /* Check if this ID is in the lookup cache */
+    if (type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(id)] == info)
+        type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(id)] = NULL;
 
     H5_GCC_DIAG_OFF("cast-qual")
     ret_value = (void *)info->object; /* (Casting away const OK -QAK) */
@@ -1603,15 +1607,15 @@ H5I__find_id(hid_t id)
     if (!type_info || type_info->init_count <= 0)
         HGOTO_DONE(NULL)
 
-    /* Check for same ID as we have looked up last time */
-    if (type_info->last_id_info && type_info->last_id_info->id == id)
-        id_info = type_info->last_id_info;
-    else {
+    /* Check for the ID in the lookup cache */
+    id_info = type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(id)];
+    if (!id_info || id_info->id != id) {
         /* Locate the ID node for the ID */
         id_info = (H5I_id_info_t *)H5SL_search(type_info->ids, &id);
 
         /* Remember this ID */
-        type_info->last_id_info = id_info;
+        if (id_info)
+            type_info->lookup_cache[H5I_LOOKUP_CACHE_SLOT(id)] = id_info;
     }
 
     /* Check if this is a future ID */
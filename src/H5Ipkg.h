@@ -57,6 +57,16 @@
 /* Map an ID to an ID type number */
 #define H5I_TYPE(a) ((H5I_type_t)(((hid_t)(a) >> ID_BITS) & TYPE_MASK))
 
+/*
+ * Number of entries in each type's direct-mapped cache of recently used
+ * IDs (must be a power of two).  IDs within a type are handed out
+ * sequentially, so the most recently created IDs map to distinct slots.
+ */
+#define H5I_LOOKUP_CACHE_SIZE 64
+
+/* Map an ID to its slot in the lookup cache */
+#define H5I_LOOKUP_CACHE_SLOT(a) ((size_t)((hid_t)(a) & (H5I_LOOKUP_CACHE_SIZE - 1)))
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -80,8 +90,8 @@ typedef struct H5I_type_info_t {
     unsigned           init_count;   /* # of times this type has been initialized */
     uint64_t           id_count;     /* Current number of IDs held */
     uint64_t           nextid;       /* ID to use for the next object */
-    H5I_id_info_t *    last_id_info; /* Info for most recent ID looked up */
-    H5SL_t *           ids;          /* Pointer to skip list that stores IDs */
+    H5I_id_info_t *    lookup_cache[H5I_LOOKUP_CACHE_SIZE]; /* Info for recent IDs looked up */
+    H5SL_t *           ids;                                 /* Pointer to skip list that stores IDs */
 } H5I_type_info_t;
 
 /*****************************/
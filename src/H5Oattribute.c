@@ -102,6 +102,16 @@ typedef struct {
     hbool_t *exists; /* Pointer to flag to indicate attribute exists */
 } H5O_iter_xst_t;
 
+/* User data for iteration when searching for an opened attribute */
+typedef struct {
+    /* down */
+    const H5O_loc_t *loc;  /* Object location attribute is attached to */
+    const char *     name; /* Name of attribute to find */
+
+    /* up */
+    H5A_t *attr; /* Opened attribute found */
+} H5O_iter_fnd_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -111,6 +121,7 @@ typedef struct {
 /********************/
 static herr_t H5O__attr_to_dense_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned H5_ATTR_UNUSED sequence,
                                     unsigned *oh_modified, void *_udata);
+static int    H5O__attr_find_opened_attr_cb(void *obj_ptr, hid_t H5_ATTR_UNUSED obj_id, void *_udata);
 static htri_t H5O__attr_find_opened_attr(const H5O_loc_t *loc, H5A_t **attr, const char *name_to_open);
 static herr_t H5O__attr_open_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned sequence,
                                 unsigned H5_ATTR_UNUSED *oh_modified, void *_udata);
@@ -629,12 +640,48 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O__attr_open_by_idx() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_find_opened_attr_cb
+ *
+ * Purpose:     ID iteration callback for H5O__attr_find_opened_attr: checks
+ *              whether an opened attribute is the one being searched for.
+ *
+ * Return:      H5_ITER_STOP if found, H5_ITER_CONT otherwise (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5O__attr_find_opened_attr_cb(void *obj_ptr, hid_t H5_ATTR_UNUSED obj_id, void *_udata)
+{
+    H5A_t *         attr      = (H5A_t *)obj_ptr;          /* Opened attribute */
+    H5O_iter_fnd_t *udata     = (H5O_iter_fnd_t *)_udata; /* User data for callback */
+    int             ret_value = H5_ITER_CONT;             /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Verify whether it's the right object.  The attribute must be opened
+     *  through the same file, be attached to the same object and have the
+     *  same name.  (Cheapest comparisons first)
+     */
+    if (attr->oloc.addr == udata->loc->addr && attr->oloc.file == udata->loc->file &&
+        !HDstrcmp(udata->name, attr->shared->name)) {
+        udata->attr = attr;
+        ret_value   = H5_ITER_STOP;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_find_opened_attr_cb() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__attr_find_opened_attr
  *
  * Purpose:     Find out whether an attribute has been opened by giving
  *              the name.  Return the pointer to the object if found.
  *
+ *              The opened attribute IDs are searched in a single pass,
+ *              stopping at the first match, instead of first building a
+ *              list of all of them.
+ *
  * Return:      TRUE:	found the already opened object
  *              FALSE:  didn't find the opened object
  *              FAIL:	function failed.
@@ -647,65 +694,26 @@ done:
 static htri_t
 H5O__attr_find_opened_attr(const H5O_loc_t *loc, H5A_t **attr, const char *name_to_open)
 {
-    hid_t *       attr_id_list = NULL; /* List of IDs for opened attributes */
-    unsigned long loc_fnum;            /* File serial # for object */
-    size_t        num_open_attr;       /* Number of opened attributes */
-    htri_t        ret_value = FALSE;   /* Return value */
+    H5O_iter_fnd_t udata;             /* User data for ID iteration */
+    htri_t         ret_value = FALSE; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Get file serial number for the location of attribute */
-    if (H5F_get_fileno(loc->file, &loc_fnum) < 0)
-        HGOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "can't get file serial number")
-
-    /* Count all opened attributes */
-    if (H5F_get_obj_count(loc->file, H5F_OBJ_ATTR | H5F_OBJ_LOCAL, FALSE, &num_open_attr) < 0)
-        HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't count opened attributes")
-
-    /* Find out whether the attribute has been opened */
-    if (num_open_attr) {
-        size_t check_num_attr; /* Number of open attribute IDs */
-        size_t u;              /* Local index variable */
-
-        /* Allocate space for the attribute ID list */
-        if (NULL == (attr_id_list = (hid_t *)H5MM_malloc(num_open_attr * sizeof(hid_t))))
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "unable to allocate memory for attribute ID list")
-
-        /* Retrieve the IDs of all opened attributes */
-        if (H5F_get_obj_ids(loc->file, H5F_OBJ_ATTR | H5F_OBJ_LOCAL, num_open_attr, attr_id_list, FALSE,
-                            &check_num_attr) < 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get IDs of opened attributes")
-        if (check_num_attr != num_open_attr)
-            HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "open attribute count mismatch")
-
-        /* Iterate over the attributes */
-        for (u = 0; u < num_open_attr; u++) {
-            unsigned long attr_fnum; /* Attributes file serial number */
-
-            /* Get pointer to attribute */
-            if (NULL == (*attr = (H5A_t *)H5VL_object_verify(attr_id_list[u], H5I_ATTR)))
-                HGOTO_ERROR(H5E_ATTR, H5E_BADTYPE, FAIL, "not an attribute")
-
-            /* Get file serial number for attribute */
-            if (H5F_get_fileno((*attr)->oloc.file, &attr_fnum) < 0)
-                HGOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "can't get file serial number")
-
-            /* Verify whether it's the right object.  The attribute name, object
-             *  address to which the attribute is attached, and file serial
-             *  number should all match.
-             */
-            if (!HDstrcmp(name_to_open, (*attr)->shared->name) && loc->addr == (*attr)->oloc.addr &&
-                loc_fnum == attr_fnum) {
-                ret_value = TRUE;
-                break;
-            } /* end if */
-        }     /* end for */
-    }         /* end if */
+    /* Set up user data for iteration */
+    udata.loc  = loc;
+    udata.name = name_to_open;
+    udata.attr = NULL;
 
-done:
-    if (attr_id_list)
-        H5MM_free(attr_id_list);
+    /* Search the opened attributes */
+    if (H5I_iterate(H5I_ATTR, H5O__attr_find_opened_attr_cb, &udata, FALSE) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "can't iterate over opened attributes")
 
+    if (udata.attr) {
+        *attr     = udata.attr;
+        ret_value = TRUE;
+    } /* end if */
+
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O__attr_find_opened_attr() */
 
@@ -1928,6 +1928,7 @@ H5T__conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5MM_xfree(priv->subset_info.runs);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T__conv_struct_free() */
@@ -2123,9 +2124,54 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     else /* If the numbers of source and dest members are equal and no conversion is needed,
           * the case should have been handled as noop earlier in H5Dio.c. */
     {
-        ;
+        priv->subset_info.subset = H5T_SUBSET_FALSE;
     }
 
+    /* If the destination members aren't a prefix of the source, they may
+     * still all come from source members without conversion, just at other
+     * offsets (e.g. reading a few fields of a table).  Record the byte runs
+     * to copy for each element, merging members adjacent in both types.
+     */
+    priv->subset_info.runs  = (H5T_subset_run_t *)H5MM_xfree(priv->subset_info.runs);
+    priv->subset_info.nruns = 0;
+    if (priv->subset_info.subset == H5T_SUBSET_FALSE && dst_nmembs > 0 && dst_nmembs <= src_nmembs) {
+        H5T_subset_run_t *runs;
+        unsigned          nmapped = 0;
+
+        for (i = 0; i < src_nmembs; i++)
+            if (src2dst[i] >= 0) {
+                if ((priv->memb_path[i])->is_noop == FALSE)
+                    break;
+                nmapped++;
+            } /* end if */
+
+        if (i == src_nmembs && nmapped == dst_nmembs) {
+            if (NULL == (runs = (H5T_subset_run_t *)H5MM_malloc(dst_nmembs * sizeof(H5T_subset_run_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+            for (i = 0; i < src_nmembs; i++)
+                if (src2dst[i] >= 0) {
+                    const H5T_cmemb_t *src_memb = &src->shared->u.compnd.memb[i];
+                    const H5T_cmemb_t *dst_memb = &dst->shared->u.compnd.memb[src2dst[i]];
+                    H5T_subset_run_t * prev =
+                        priv->subset_info.nruns ? &runs[priv->subset_info.nruns - 1] : NULL;
+
+                    if (prev && prev->src_offset + prev->size == src_memb->offset &&
+                        prev->dst_offset + prev->size == dst_memb->offset)
+                        prev->size += src_memb->size;
+                    else {
+                        runs[priv->subset_info.nruns].src_offset = src_memb->offset;
+                        runs[priv->subset_info.nruns].dst_offset = dst_memb->offset;
+                        runs[priv->subset_info.nruns].size       = src_memb->size;
+                        priv->subset_info.nruns++;
+                    } /* end else */
+                }     /* end if */
+
+            priv->subset_info.runs   = runs;
+            priv->subset_info.subset = H5T_SUBSET_DST_MEMBS;
+        } /* end if */
+    }     /* end if */
+
     cdata->recalc = FALSE;
 
 done:
@@ -2567,6 +2613,24 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
                     xbkg += bkg_stride;
                 } /* end for */
             }     /* end if */
+            else if (priv->subset_info.subset == H5T_SUBSET_DST_MEMBS) {
+                /* If the destination members all come unconverted from the
+                 * source, copy their byte runs straight to the background buffer.
+                 */
+                const H5T_subset_run_t *runs  = priv->subset_info.runs;
+                size_t                  nruns = priv->subset_info.nruns;
+
+                xbuf = buf;
+                xbkg = bkg;
+                for (elmtno = 0; elmtno < nelmts; elmtno++) {
+                    for (u = 0; u < nruns; u++)
+                        H5MM_memcpy(xbkg + runs[u].dst_offset, xbuf + runs[u].src_offset, runs[u].size);
+
+                    /* Update pointers */
+                    xbuf += buf_stride;
+                    xbkg += bkg_stride;
+                } /* end for */
+            }     /* end else-if */
             else {
                 /*
                  * For each member where the destination is not larger than the
@@ -1493,6 +1493,8 @@ H5VM_memcpyvv(void *_dst, size_t dst_max_nseq, size_t *dst_curr_seq, size_t dst_
     size_t   tmp_dst_len;                       /* Temporary dest. length value */
     size_t   tmp_src_len;                       /* Temporary source length value */
     size_t   acc_len;                           /* Accumulated length of sequences */
+    size_t   nrun;                              /* Number of equal-length sequence pairs */
+    size_t   max_run;                           /* Number of sequence pairs left */
     ssize_t  ret_value = 0;                     /* Return value (Total size of sequence in bytes) */
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
@@ -1619,40 +1621,49 @@ dst_smaller:
     /* Destination sequence and source sequence are same length */
     else {
 equal:
-        acc_len = 0;
-        do {
-            /* Copy data */
-            H5MM_memcpy(dst, src, tmp_dst_len);
-
-            /* Accumulate number of bytes copied */
-            acc_len += tmp_dst_len;
-
-            /* Advance source & destination offset & check for being finished */
-            src_off_ptr++;
-            dst_off_ptr++;
-            if (src_off_ptr >= max_src_off_ptr || dst_off_ptr >= max_dst_off_ptr)
-                /* Done with sequences */
-                goto finished;
-
-            /* Update source information */
-            src_len_ptr++;
-            tmp_src_len = *src_len_ptr;
-            src         = (const unsigned char *)_src + *src_off_ptr;
-
-            /* Update destination information */
-            dst_len_ptr++;
-            tmp_dst_len = *dst_len_ptr;
-            dst         = (unsigned char *)_dst + *dst_off_ptr;
-        } while (tmp_dst_len == tmp_src_len);
+        /* Copy the first pair of sequences, which may be partly copied
+         * already and so can't be found from the offset arrays */
+        H5MM_memcpy(dst, src, tmp_dst_len);
+
+        /* Find the rest of the run of sequence pairs with this length and
+         * copy them together */
+        max_run = MIN((size_t)(max_src_off_ptr - src_off_ptr), (size_t)(max_dst_off_ptr - dst_off_ptr));
+        nrun    = 1;
+        while (nrun < max_run && src_len_ptr[nrun] == tmp_dst_len && dst_len_ptr[nrun] == tmp_dst_len)
+            nrun++;
+        H5VM_memcpy_seq_run(_dst, dst_off_ptr + 1, _src, src_off_ptr + 1, nrun - 1, tmp_dst_len);
+
+        /* Accumulate number of bytes copied */
+        acc_len = nrun * tmp_dst_len;
+
+        /* Advance source & destination offset & check for being finished */
+        src_off_ptr += nrun;
+        dst_off_ptr += nrun;
+        if (src_off_ptr >= max_src_off_ptr || dst_off_ptr >= max_dst_off_ptr)
+            /* Done with sequences */
+            goto finished;
+
+        /* Update source information */
+        src_len_ptr += nrun;
+        tmp_src_len = *src_len_ptr;
+        src         = (const unsigned char *)_src + *src_off_ptr;
+
+        /* Update destination information */
+        dst_len_ptr += nrun;
+        tmp_dst_len = *dst_len_ptr;
+        dst         = (unsigned char *)_dst + *dst_off_ptr;
 
         /* Roll accumulated sequence lengths into return value */
         ret_value += (ssize_t)acc_len;
 
         /* Transition to next state */
+        /* (A run can end on a pair of equal-length sequences of another length) */
         if (tmp_dst_len < tmp_src_len)
             goto dst_smaller;
-        else
+        else if (tmp_src_len < tmp_dst_len)
             goto src_smaller;
+        else
+            goto equal;
     } /* end else */
 
 finished:
@@ -353,6 +353,91 @@ H5VM_vector_inc(int n, hsize_t *v1, const hsize_t *v2)
         *v1++ += *v2++;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VM_memcpy_seq_run_len
+ *
+ * Purpose:     Body of H5VM_memcpy_seq_run, inlined there once for each
+ *              constant sequence length.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static inline void H5_ATTR_UNUSED
+H5VM_memcpy_seq_run_len(unsigned char *dst, const hsize_t *dst_off, const unsigned char *src,
+                        const hsize_t *src_off, size_t nseq, size_t seq_len)
+{
+    size_t u;
+
+    for (u = 0; u < nseq; u++) {
+        unsigned char *      d = dst + (dst_off ? dst_off[u] : (hsize_t)(u * seq_len));
+        const unsigned char *s = src + (src_off ? src_off[u] : (hsize_t)(u * seq_len));
+
+#ifdef NDEBUG
+        HDmemcpy(d, s, seq_len);
+#else  /* NDEBUG */
+        H5MM_memcpy(d, s, seq_len);
+#endif /* NDEBUG */
+    }
+} /* end H5VM_memcpy_seq_run_len() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VM_memcpy_seq_run
+ *
+ * Purpose:     Copies NSEQ sequences of SEQ_LEN bytes each, sequence U from
+ *              SRC + SRC_OFF[U] to DST + DST_OFF[U].  A NULL offset array
+ *              means that side is contiguous, with sequence U at
+ *              U * SEQ_LEN.
+ *
+ *              Regular selections with small blocks (e.g. every n-th
+ *              element) produce long runs of such sequences.  Lengths up
+ *              to 16 bytes are copied with a constant size, which lets the
+ *              compiler replace each memcpy call with a load and a store.
+ *              Debug builds copy with H5MM_memcpy, to keep its check for
+ *              overlapping buffers.
+ *
+ * Note:        Although this routine is 'static' in this file, that's intended
+ *              only as an optimization and the naming (with a single underscore)
+ *              reflects its inclusion in a "private" header file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static inline void H5_ATTR_UNUSED
+H5VM_memcpy_seq_run(void *dst, const hsize_t *dst_off, const void *src, const hsize_t *src_off, size_t nseq,
+                    size_t seq_len)
+{
+    unsigned char *      d = (unsigned char *)dst;
+    const unsigned char *s = (const unsigned char *)src;
+
+    switch (seq_len) {
+        case 1:
+            H5VM_memcpy_seq_run_len(d, dst_off, s, src_off, nseq, 1);
+            break;
+
+        case 2:
+            H5VM_memcpy_seq_run_len(d, dst_off, s, src_off, nseq, 2);
+            break;
+
+        case 4:
+            H5VM_memcpy_seq_run_len(d, dst_off, s, src_off, nseq, 4);
+            break;
+
+        case 8:
+            H5VM_memcpy_seq_run_len(d, dst_off, s, src_off, nseq, 8);
+            break;
+
+        case 16:
+            H5VM_memcpy_seq_run_len(d, dst_off, s, src_off, nseq, 16);
+            break;
+
+        default:
+            H5VM_memcpy_seq_run_len(d, dst_off, s, src_off, nseq, seq_len);
+            break;
+    } /* end switch */
+} /* end H5VM_memcpy_seq_run() */
+
 /* Lookup table for general log2(n) routine */
 static const unsigned char LogTable256[] = {
     /* clang-clang-format off */
@@ -20,6 +20,11 @@
 #include "H5VMprivate.h" /* H5VM_array_fill                     */
 #include "H5Zpkg.h"      /* Data filters                                */
 
+/* Size in bytes of the blocks of the buffer a full data transform is
+ * evaluated on, so that each operator's pass over a block stays in cache
+ * (and polynomial transforms only need block-sized copies of the data) */
+#define H5Z_XFORM_BLOCK_SIZE (16 * 1024)
+
 /* Token types */
 typedef enum {
     H5Z_XFORM_ERROR,
@@ -1064,33 +1069,47 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size
     } /* end if */
     /* Otherwise, do the full data transform */
     else {
-        /* Optimization for linear transform: */
-        if (data_xform_prop->dat_val_pointers->num_ptrs == 1)
-            data_xform_prop->dat_val_pointers->ptr_dat_val[0] = array;
+        size_t elmt_size;    /* Size of an array element */
+        size_t block_nelmts; /* Number of elements evaluated at a time */
+        size_t start;        /* First element of the current block */
 
-        /* If it's a quadratic transform, we have no choice but to store multiple copies of the data */
-        else {
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++) {
-                if (NULL == (data_xform_prop->dat_val_pointers->ptr_dat_val[i] = (void *)H5MM_malloc(
-                                 array_size * H5T_get_size((H5T_t *)H5I_object(array_type)))))
+        elmt_size    = H5T_get_size((H5T_t *)H5I_object(array_type));
+        block_nelmts = MAX(H5Z_XFORM_BLOCK_SIZE / elmt_size, 1);
+        block_nelmts = MIN(block_nelmts, array_size);
+
+        /* If it's a quadratic transform, we have no choice but to store multiple
+         * copies of the data (one block at a time) */
+        if (array_size > 0 && data_xform_prop->dat_val_pointers->num_ptrs > 1)
+            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
+                if (NULL == (data_xform_prop->dat_val_pointers->ptr_dat_val[i] =
+                                 (void *)H5MM_malloc(block_nelmts * elmt_size)))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
                                 "Ran out of memory trying to allocate space for data in data transform")
 
-                H5MM_memcpy(data_xform_prop->dat_val_pointers->ptr_dat_val[i], array,
-                            array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
-            } /* end for */
-        }     /* end else */
+        /* Evaluate the transform on each block of the array */
+        for (start = 0; start < array_size; start += block_nelmts) {
+            uint8_t *block  = (uint8_t *)array + start * elmt_size;
+            size_t   nelmts = MIN(block_nelmts, array_size - start);
 
-        if (H5Z__xform_eval_full(tree, array_size, array_type, &res) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
+            /* Optimization for linear transform: */
+            if (data_xform_prop->dat_val_pointers->num_ptrs == 1)
+                data_xform_prop->dat_val_pointers->ptr_dat_val[0] = block;
+            else
+                for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
+                    H5MM_memcpy(data_xform_prop->dat_val_pointers->ptr_dat_val[i], block, nelmts * elmt_size);
 
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            H5MM_memcpy(array, res.value.dat_val, array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
+            if (H5Z__xform_eval_full(tree, nelmts, array_type, &res) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
+
+            if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
+                H5MM_memcpy(block, res.value.dat_val, nelmts * elmt_size);
+        } /* end for */
 
         /* Free the temporary arrays we used */
         if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
             for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
+                data_xform_prop->dat_val_pointers->ptr_dat_val[i] =
+                    H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
     } /* end else */
 
 done:
@@ -1099,7 +1118,7 @@ done:
          * polynomial transforms of high order) we free those arrays which we already allocated */
         if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
             for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                if (data_xform_prop->dat_val_pointers->ptr_dat_val[i])
+                data_xform_prop->dat_val_pointers->ptr_dat_val[i] =
                     H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
     } /* end if */
 
@@ -25,7 +25,7 @@
 
 #include "h5test.h"
 
-const char *FILENAME[] = {"cmpd_dset", "src_subset", "dst_subset", NULL};
+const char *FILENAME[] = {"cmpd_dset", "src_subset", "dst_subset", "dst_membs", NULL};
 
 const char *DSET_NAME[] = {"contig_src_subset", "chunk_src_subset", "contig_dst_subset", "chunk_dst_subset",
                            NULL};
@@ -84,6 +84,18 @@ typedef struct s6_t {
     unsigned int post;
 } s6_t;
 
+/* Some members of s1 in another order and at other offsets, with
+ * fields that are not part of the HDF5 datatype in between */
+typedef struct s7_t {
+    unsigned int pad0;
+    unsigned int e;
+    unsigned int pad1;
+    unsigned int b;
+    unsigned int c[4];
+    unsigned int a;
+    unsigned int pad2;
+} s7_t;
+
 /* Structures for testing the optimization for the Chicago company. */
 typedef struct {
     int    a, b, c[8], d, e;
@@ -2206,6 +2218,206 @@ error:
     return 1;
 } /* test_ooo_order */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_dst_membs_subset
+ *
+ * Purpose:     Test the optimization for a destination type whose members
+ *              all come unconverted from members of the source type, but
+ *              in another order and at other offsets (H5T_SUBSET_DST_MEMBS).
+ *              Bytes of the destination outside its members must not be
+ *              touched by H5Dread and must come from the background buffer
+ *              for H5Tconvert.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        1
+ *-------------------------------------------------------------------------
+ */
+#define DST_MEMBS_NELMTS 40
+#define DST_MEMBS_STRIDE 3
+#define DST_MEMBS_COUNT  12
+#define DST_MEMBS_FILL   0xdeadbeef
+static unsigned
+test_dst_membs_subset(char *filename, hid_t fapl)
+{
+    hid_t              file         = H5I_INVALID_HID;
+    hid_t              dataset      = H5I_INVALID_HID;
+    hid_t              fspace       = H5I_INVALID_HID;
+    hid_t              mspace       = H5I_INVALID_HID;
+    hid_t              s1_tid       = H5I_INVALID_HID;
+    hid_t              s7_tid       = H5I_INVALID_HID;
+    hid_t              file_tid     = H5I_INVALID_HID;
+    hid_t              array_dt     = H5I_INVALID_HID;
+    hsize_t            dim          = DST_MEMBS_NELMTS;
+    hsize_t            memb_size[1] = {4};
+    hsize_t            start, stride, count;
+    H5T_path_t *       tpath;
+    H5T_subset_info_t *subset;
+    s1_t *             s1    = NULL;
+    s7_t *             s7    = NULL;
+    s7_t *             s7bkg = NULL;
+    unsigned           i, j;
+
+    if (NULL == (s1 = (s1_t *)HDcalloc(DST_MEMBS_NELMTS, sizeof(s1_t))))
+        TEST_ERROR
+    if (NULL == (s7 = (s7_t *)HDcalloc(DST_MEMBS_NELMTS, sizeof(s7_t))))
+        TEST_ERROR
+    if (NULL == (s7bkg = (s7_t *)HDcalloc(DST_MEMBS_NELMTS, sizeof(s7_t))))
+        TEST_ERROR
+
+    for (i = 0; i < DST_MEMBS_NELMTS; i++) {
+        s1[i].a = 8 * i + 0;
+        s1[i].b = 8 * i + 1;
+        for (j = 0; j < 4; j++)
+            s1[i].c[j] = 8 * i + j + 2;
+        s1[i].d = 8 * i + 6;
+        s1[i].e = 8 * i + 7;
+    } /* end for */
+
+    /* Create the datatypes */
+    if ((array_dt = H5Tarray_create2(H5T_NATIVE_UINT, 1, memb_size)) < 0)
+        TEST_ERROR
+    if ((s1_tid = H5Tcreate(H5T_COMPOUND, sizeof(s1_t))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(s1_tid, "a", HOFFSET(s1_t, a), H5T_NATIVE_UINT) < 0 ||
+        H5Tinsert(s1_tid, "b", HOFFSET(s1_t, b), H5T_NATIVE_UINT) < 0 ||
+        H5Tinsert(s1_tid, "c", HOFFSET(s1_t, c), array_dt) < 0 ||
+        H5Tinsert(s1_tid, "d", HOFFSET(s1_t, d), H5T_NATIVE_UINT) < 0 ||
+        H5Tinsert(s1_tid, "e", HOFFSET(s1_t, e), H5T_NATIVE_UINT) < 0)
+        TEST_ERROR
+    if ((s7_tid = H5Tcreate(H5T_COMPOUND, sizeof(s7_t))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(s7_tid, "e", HOFFSET(s7_t, e), H5T_NATIVE_UINT) < 0 ||
+        H5Tinsert(s7_tid, "b", HOFFSET(s7_t, b), H5T_NATIVE_UINT) < 0 ||
+        H5Tinsert(s7_tid, "c", HOFFSET(s7_t, c), array_dt) < 0 ||
+        H5Tinsert(s7_tid, "a", HOFFSET(s7_t, a), H5T_NATIVE_UINT) < 0)
+        TEST_ERROR
+
+    TESTING("reordered member subset read through a strided selection");
+
+    /* Write the dataset */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((fspace = H5Screate_simple(1, &dim, NULL)) < 0)
+        TEST_ERROR
+    if ((dataset = H5Dcreate2(file, "s1", s1_tid, fspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dataset, s1_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, s1) < 0)
+        TEST_ERROR
+
+    /* The conversion must take the optimized path */
+    if ((file_tid = H5Dget_type(dataset)) < 0)
+        TEST_ERROR
+    if (NULL == (tpath = H5T_path_find((H5T_t *)H5I_object(file_tid), (H5T_t *)H5I_object(s7_tid))))
+        TEST_ERROR
+    if (NULL == (subset = H5T_path_compound_subset(tpath)))
+        TEST_ERROR
+    if (subset->subset != H5T_SUBSET_DST_MEMBS)
+        TEST_ERROR
+    /* b and c are adjacent in both types */
+    if (subset->nruns != 3)
+        TEST_ERROR
+
+    /* Read every third element into consecutive elements of the buffer */
+    start  = 1;
+    stride = DST_MEMBS_STRIDE;
+    count  = DST_MEMBS_COUNT;
+    if (H5Sselect_hyperslab(fspace, H5S_SELECT_SET, &start, &stride, &count, NULL) < 0)
+        TEST_ERROR
+    dim = DST_MEMBS_COUNT;
+    if ((mspace = H5Screate_simple(1, &dim, NULL)) < 0)
+        TEST_ERROR
+    for (i = 0; i < DST_MEMBS_NELMTS; i++) {
+        s7[i].pad0 = DST_MEMBS_FILL;
+        s7[i].pad1 = DST_MEMBS_FILL;
+        s7[i].pad2 = DST_MEMBS_FILL;
+    } /* end for */
+    if (H5Dread(dataset, s7_tid, mspace, fspace, H5P_DEFAULT, s7) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < DST_MEMBS_COUNT; i++) {
+        const s1_t *src = &s1[1 + i * DST_MEMBS_STRIDE];
+
+        if (s7[i].a != src->a || s7[i].b != src->b || s7[i].e != src->e ||
+            HDmemcmp(s7[i].c, src->c, sizeof(src->c)) != 0)
+            TEST_ERROR
+        if (s7[i].pad0 != DST_MEMBS_FILL || s7[i].pad1 != DST_MEMBS_FILL || s7[i].pad2 != DST_MEMBS_FILL)
+            TEST_ERROR
+    } /* end for */
+
+    PASSED();
+
+    TESTING("reordered member subset H5Tconvert with background buffer");
+
+    /* Convert in place; the destination elements are larger */
+    HDmemset(s7, 0, DST_MEMBS_NELMTS * sizeof(s7_t));
+    HDmemcpy(s7, s1, DST_MEMBS_NELMTS * sizeof(s1_t));
+    for (i = 0; i < DST_MEMBS_NELMTS; i++) {
+        s7bkg[i].pad0 = DST_MEMBS_FILL;
+        s7bkg[i].e    = DST_MEMBS_FILL;
+        s7bkg[i].pad1 = DST_MEMBS_FILL - 1;
+        s7bkg[i].pad2 = i;
+    } /* end for */
+    if (H5Tconvert(s1_tid, s7_tid, (size_t)DST_MEMBS_NELMTS, s7, s7bkg, H5P_DEFAULT) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < DST_MEMBS_NELMTS; i++) {
+        if (s7[i].a != s1[i].a || s7[i].b != s1[i].b || s7[i].e != s1[i].e ||
+            HDmemcmp(s7[i].c, s1[i].c, sizeof(s1[i].c)) != 0)
+            TEST_ERROR
+        if (s7[i].pad0 != DST_MEMBS_FILL || s7[i].pad1 != DST_MEMBS_FILL - 1 || s7[i].pad2 != i)
+            TEST_ERROR
+    } /* end for */
+
+    PASSED();
+
+    /* Close */
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+    if (H5Sclose(fspace) < 0)
+        TEST_ERROR
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR
+    if (H5Tclose(file_tid) < 0)
+        TEST_ERROR
+    if (H5Tclose(s1_tid) < 0)
+        TEST_ERROR
+    if (H5Tclose(s7_tid) < 0)
+        TEST_ERROR
+    if (H5Tclose(array_dt) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    HDfree(s1);
+    HDfree(s7);
+    HDfree(s7bkg);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Sclose(fspace);
+        H5Sclose(mspace);
+        H5Tclose(file_tid);
+        H5Tclose(s1_tid);
+        H5Tclose(s7_tid);
+        H5Tclose(array_dt);
+        H5Fclose(file);
+    }
+    H5E_END_TRY
+    if (s1)
+        HDfree(s1);
+    if (s7)
+        HDfree(s7);
+    if (s7bkg)
+        HDfree(s7bkg);
+    HDputs("*** DATASET TESTS FAILED ***");
+    return 1;
+} /* test_dst_membs_subset */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -2257,6 +2469,10 @@ main(int argc, char *argv[])
     h5_fixname(FILENAME[2], fapl_id, fname, sizeof(fname));
     nerrors += test_hdf5_dst_subset(fname, fapl_id);
 
+    HDputs("Testing the optimization of when the dest members are reordered source members:");
+    h5_fixname(FILENAME[3], fapl_id, fname, sizeof(fname));
+    nerrors += test_dst_membs_subset(fname, fapl_id);
+
     HDputs("Testing that compound types can be packed out of order:");
     nerrors += test_pack_ooo();
 
@@ -17,11 +17,16 @@
 #define COLS      18
 #define FLOAT_TOL 0.0001F
 
+/* More doubles than fit in one transform evaluation block, and not a
+ * multiple of that block */
+#define BLOCKS_NELMTS 5000
+
 static int init_test(hid_t file_id);
 static int test_copy(hid_t dxpl_id_c_to_f_copy, hid_t dxpl_id_polynomial_copy);
 static int test_trivial(hid_t dxpl_id_simple);
 static int test_poly(hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
+static int test_blocks(hid_t file);
 static int test_set(void);
 static int test_getset(hid_t dxpl_id_simple);
 
@@ -388,6 +393,8 @@ main(void)
         TEST_ERROR;
     if (test_specials(file_id) < 0)
         TEST_ERROR;
+    if (test_blocks(file_id) < 0)
+        TEST_ERROR;
 
     /* Close the objects we opened/created */
     if (H5Dclose(dset_id_int) < 0)
@@ -741,6 +748,96 @@ error:
     return -1;
 }
 
+static int
+test_blocks(hid_t file)
+{
+    hid_t       dxpl_id   = -1;
+    hid_t       dset_id   = -1;
+    hid_t       dataspace = -1;
+    hsize_t     dim[1]    = {BLOCKS_NELMTS};
+    double *    data      = NULL;
+    double *    data_res  = NULL;
+    double *    read_buf  = NULL;
+    size_t      i;
+    const char *polynomial = "(2+x)* ((x-8)/2)";
+
+    TESTING("data transform over several evaluation blocks")
+
+    if (NULL == (data = (double *)HDmalloc(BLOCKS_NELMTS * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (data_res = (double *)HDmalloc(BLOCKS_NELMTS * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (read_buf = (double *)HDmalloc(BLOCKS_NELMTS * sizeof(double))))
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++) {
+        data[i]     = (double)i / 10.0 - 100.0;
+        data_res[i] = (2 + data[i]) * ((data[i] - 8) / 2);
+    }
+
+    if ((dataspace = H5Screate_simple(1, dim, NULL)) < 0)
+        TEST_ERROR
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pset_data_transform(dxpl_id, polynomial) < 0)
+        TEST_ERROR
+
+    /* Transform on write */
+    if ((dset_id = H5Dcreate2(file, "/blocks_write", H5T_NATIVE_DOUBLE, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl_id, data) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0)
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++)
+        if (HDfabs(read_buf[i] - data_res[i]) > (double)FLOAT_TOL)
+            FAIL_PUTS_ERROR("    ERROR: Conversion failed to match computed data\n")
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+
+    /* Transform on read */
+    if ((dset_id = H5Dcreate2(file, "/blocks_read", H5T_NATIVE_DOUBLE, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+    HDmemset(read_buf, 0, BLOCKS_NELMTS * sizeof(double));
+    if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl_id, read_buf) < 0)
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++)
+        if (HDfabs(read_buf[i] - data_res[i]) > (double)FLOAT_TOL)
+            FAIL_PUTS_ERROR("    ERROR: Conversion failed to match computed data\n")
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+
+    if (H5Pclose(dxpl_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(dataspace) < 0)
+        TEST_ERROR
+
+    HDfree(read_buf);
+    HDfree(data_res);
+    HDfree(data);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dxpl_id);
+        H5Sclose(dataspace);
+    }
+    H5E_END_TRY
+    HDfree(read_buf);
+    HDfree(data_res);
+    HDfree(data);
+    return -1;
+}
+
 static int
 test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy)
 {
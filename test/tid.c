@@ -867,6 +867,106 @@ error:
     return -1;
 } /* end test_remove_clear_type() */
 
+/* Test that looking up an ID cleared by H5Iclear_type fails, even when the
+ * ID was recently looked up and new IDs have been registered since.
+ */
+#define CTL_NIDS     (2 * H5I_LOOKUP_CACHE_SIZE)
+#define CTL_NNEW_IDS (H5I_LOOKUP_CACHE_SIZE / 4)
+static int
+test_clear_type_lookup(void)
+{
+    H5I_type_t obj_type;
+    hid_t      old_ids[CTL_NIDS];
+    hid_t      new_ids[CTL_NNEW_IDS];
+    int        objects[CTL_NIDS];
+    void *     obj;
+    size_t     u;
+    herr_t     ret; /* return value */
+
+    /* Register a user-defined type with no free callback */
+    obj_type = H5Iregister_type((size_t)8, 0, NULL);
+    CHECK(obj_type, H5I_BADID, "H5Iregister_type");
+    if (obj_type == H5I_BADID)
+        goto error;
+
+    /* Register IDs and look each of them up */
+    for (u = 0; u < CTL_NIDS; u++) {
+        old_ids[u] = H5Iregister(obj_type, &objects[u]);
+        CHECK(old_ids[u], H5I_INVALID_HID, "H5Iregister");
+        if (old_ids[u] == H5I_INVALID_HID)
+            goto error;
+    }
+    for (u = 0; u < CTL_NIDS; u++) {
+        obj = H5Iobject_verify(old_ids[u], obj_type);
+        CHECK_PTR_EQ(obj, &objects[u], "H5Iobject_verify");
+        if (obj != &objects[u])
+            goto error;
+    }
+
+    /* Clear the type */
+    ret = H5Iclear_type(obj_type, TRUE);
+    CHECK(ret, FAIL, "H5Iclear_type");
+    if (ret == FAIL)
+        goto error;
+
+    /* None of the cleared IDs may be found */
+    for (u = 0; u < CTL_NIDS; u++) {
+        H5E_BEGIN_TRY
+        {
+            obj = H5Iobject_verify(old_ids[u], obj_type);
+        }
+        H5E_END_TRY
+        CHECK_PTR_NULL(obj, "H5Iobject_verify");
+        if (obj != NULL)
+            goto error;
+    }
+
+    /* Register a few new IDs, which may reuse the memory of the cleared
+     * ones, but not enough to replace every cached ID */
+    for (u = 0; u < CTL_NNEW_IDS; u++) {
+        new_ids[u] = H5Iregister(obj_type, &objects[u]);
+        CHECK(new_ids[u], H5I_INVALID_HID, "H5Iregister");
+        if (new_ids[u] == H5I_INVALID_HID)
+            goto error;
+    }
+
+    /* The cleared IDs still may not be found, but the new ones must be */
+    for (u = 0; u < CTL_NIDS; u++) {
+        H5E_BEGIN_TRY
+        {
+            obj = H5Iobject_verify(old_ids[u], obj_type);
+        }
+        H5E_END_TRY
+        CHECK_PTR_NULL(obj, "H5Iobject_verify");
+        if (obj != NULL)
+            goto error;
+    }
+    for (u = 0; u < CTL_NNEW_IDS; u++) {
+        obj = H5Iobject_verify(new_ids[u], obj_type);
+        CHECK_PTR_EQ(obj, &objects[u], "H5Iobject_verify");
+        if (obj != &objects[u])
+            goto error;
+    }
+
+    /* Destroy the type */
+    ret = H5Idestroy_type(obj_type);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    if (ret == FAIL)
+        goto error;
+
+    return 0;
+
+error:
+    /* Cleanup. For simplicity, just destroy the types and ignore errors. */
+    H5E_BEGIN_TRY
+    {
+        H5Idestroy_type(obj_type);
+    }
+    H5E_END_TRY
+
+    return -1;
+} /* end test_clear_type_lookup() */
+
 /* Typedef for future objects */
 typedef struct {
     H5I_type_t obj_type; /* ID type for actual object */
@@ -1388,6 +1488,8 @@ test_ids(void)
         TestErrPrintf("ID type list test failed\n");
     if (test_remove_clear_type() < 0)
         TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+    if (test_clear_type_lookup() < 0)
+        TestErrPrintf("ID lookup after H5Iclear_type test failed\n");
     if (test_future_ids() < 0)
         TestErrPrintf("Future ID test failed\n");
 }
@@ -19,6 +19,10 @@
 #include "h5test.h"
 #include "H5Dprivate.h" /* For H5D_VIRTUAL_DEF_LIST_SIZE */
 
+#define H5F_FRIEND /*suppress error about including H5Fpkg */
+#define H5F_TESTING
+#include "H5Fpkg.h" /* For H5F__get_nopen_files_test */
+
 typedef enum {
     TEST_API_BASIC,
     TEST_API_COPY_PLIST,
@@ -31,7 +35,8 @@ typedef enum {
 
 const char *FILENAME[] = {"vds_virt_0", "vds_virt_1", "vds_src_0",  "vds_src_1", "vds%%_src",
                           "vds_dapl",   "vds_virt_2", "vds_virt_3", "vds_src_2", "vds_src_3",
-                          "vds%%_src2", "vds_dapl2",  NULL};
+                          "vds%%_src2", "vds_dapl2",  "vds_efc_virt", "vds_efc_src0", "vds_efc_src1",
+                          "vds_efc_src2", "vds_efc_src3", NULL};
 
 /* Define to enable verbose test output */
 /* #define VDS_TEST_VERBOSE 1 */
@@ -12266,6 +12271,250 @@ error:
     return 1;
 } /* end test_dapl_values() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_efc_source_dsets
+ *
+ * Purpose:     Tests I/O on a virtual dataset with more source datasets
+ *              than its file's external file cache can hold, so source
+ *              datasets are closed after each I/O and reopened on demand.
+ *              After each I/O, the library must have no more source files
+ *              open than the cache holds plus those that I/O used.
+ *
+ * Return:      Success: 0
+ *              Failure: number of errors
+ *-------------------------------------------------------------------------
+ */
+#define EFC_NSRCS      4
+#define EFC_SRC_SIZE   10
+#define EFC_CACHE_SIZE 2
+static int
+test_efc_source_dsets(hid_t fapl)
+{
+    char    vfilename[FILENAME_BUF_SIZE];   /* Virtual file name */
+    char    srcfilename[FILENAME_BUF_SIZE]; /* Source file name */
+    hid_t   efc_fapl = -1;                  /* File access property list with a small EFC */
+    hid_t   srcfile  = -1;                  /* File with source dataset */
+    hid_t   vfile    = -1;                  /* File with virtual dset */
+    hid_t   dcpl     = -1;                  /* Dataset creation property list */
+    hid_t   srcspace = -1;                  /* Source dataspace */
+    hid_t   vspace   = -1;                  /* Virtual dataset dataspace */
+    hid_t   memspace = -1;                  /* Memory dataspace */
+    hid_t   srcdset  = -1;                  /* Source dataset */
+    hid_t   vdset    = -1;                  /* Virtual dataset */
+    hsize_t dims;                           /* Data space current size */
+    hsize_t start;                          /* Hyperslab start */
+    hsize_t count;                          /* Hyperslab count */
+    int     buf[EFC_SRC_SIZE * EFC_NSRCS];  /* Write and expected read buffer */
+    int     rbuf[EFC_SRC_SIZE * EFC_NSRCS]; /* Read buffer */
+    unsigned nfiles_base;                   /* Number of files open before any source file */
+    unsigned nfiles;                        /* Number of files open */
+    unsigned nused;                         /* Number of source files used by an I/O */
+    int      i, j, k;                       /* Local index variables */
+
+    TESTING_2("virtual dataset with more sources than the external file cache");
+
+    /* Keep a small number of source files in the cache */
+    if ((efc_fapl = H5Pcopy(fapl)) < 0)
+        TEST_ERROR
+    if (H5Pset_elink_file_cache_size(efc_fapl, EFC_CACHE_SIZE) < 0)
+        TEST_ERROR
+
+    h5_fixname(FILENAME[12], fapl, vfilename, sizeof vfilename);
+
+    /* Create the source files, each with one dataset holding its part of
+     * the virtual dataset */
+    for (i = 0; i < EFC_NSRCS * EFC_SRC_SIZE; i++)
+        buf[i] = i;
+    dims = EFC_SRC_SIZE;
+    if ((srcspace = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR
+    for (i = 0; i < EFC_NSRCS; i++) {
+        h5_fixname(FILENAME[13 + i], fapl, srcfilename, sizeof srcfilename);
+        if ((srcfile = H5Fcreate(srcfilename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR
+        if ((srcdset = H5Dcreate2(srcfile, "src_dset", H5T_NATIVE_INT, srcspace, H5P_DEFAULT, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Dwrite(srcdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &buf[i * EFC_SRC_SIZE]) < 0)
+            TEST_ERROR
+        if (H5Dclose(srcdset) < 0)
+            TEST_ERROR
+        srcdset = -1;
+        if (H5Fclose(srcfile) < 0)
+            TEST_ERROR
+        srcfile = -1;
+    } /* end for */
+
+    /* Map each source dataset to consecutive blocks of the virtual dataset */
+    dims = EFC_SRC_SIZE * EFC_NSRCS;
+    if ((vspace = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    count = EFC_SRC_SIZE;
+    for (i = 0; i < EFC_NSRCS; i++) {
+        h5_fixname(FILENAME[13 + i], fapl, srcfilename, sizeof srcfilename);
+        start = (hsize_t)(i * EFC_SRC_SIZE);
+        if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            TEST_ERROR
+        if (H5Pset_virtual(dcpl, vspace, srcfilename, "src_dset", srcspace) < 0)
+            TEST_ERROR
+    } /* end for */
+    if (H5Sselect_all(vspace) < 0)
+        TEST_ERROR
+
+    /* Create the virtual dataset and reopen its file with the small cache */
+    if ((vfile = H5Fcreate(vfilename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((vdset = H5Dcreate2(vfile, "v_dset", H5T_NATIVE_INT, vspace, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR
+    vdset = -1;
+    if (H5Fclose(vfile) < 0)
+        TEST_ERROR
+    vfile = -1;
+    if ((vfile = H5Fopen(vfilename, H5F_ACC_RDWR, efc_fapl)) < 0)
+        TEST_ERROR
+    if ((vdset = H5Dopen2(vfile, "v_dset", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5F__get_nopen_files_test(&nfiles_base) < 0)
+        TEST_ERROR
+
+    /* Read a subset spanning the second and third source datasets, then the
+     * last source dataset alone, then the full extent several times */
+    if ((memspace = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR
+    for (k = 0; k < 2; k++) {
+        start = k ? (hsize_t)((EFC_NSRCS - 1) * EFC_SRC_SIZE) : (hsize_t)(EFC_SRC_SIZE + EFC_SRC_SIZE / 2);
+        count = EFC_SRC_SIZE;
+        if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            TEST_ERROR
+        if (H5Sselect_hyperslab(memspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            TEST_ERROR
+        HDmemset(rbuf, 0, sizeof rbuf);
+        if (H5Dread(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        nused = k ? 1 : 2;
+        if (H5F__get_nopen_files_test(&nfiles) < 0)
+            TEST_ERROR
+        if (nfiles > nfiles_base + EFC_CACHE_SIZE + nused)
+            TEST_ERROR
+        for (i = 0; i < (int)(EFC_NSRCS * EFC_SRC_SIZE); i++)
+            if (rbuf[i] != ((hsize_t)i >= start && (hsize_t)i < start + count ? buf[i] : 0))
+                TEST_ERROR
+    } /* end for */
+    for (k = 0; k < 3; k++) {
+        HDmemset(rbuf, 0, sizeof rbuf);
+        if (H5Dread(vdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        if (H5F__get_nopen_files_test(&nfiles) < 0)
+            TEST_ERROR
+        if (nfiles > nfiles_base + EFC_CACHE_SIZE + EFC_NSRCS)
+            TEST_ERROR
+        for (i = 0; i < (int)(EFC_NSRCS * EFC_SRC_SIZE); i++)
+            if (rbuf[i] != buf[i])
+                TEST_ERROR
+    } /* end for */
+
+    /* Write through the virtual dataset, then read back through it */
+    for (i = 0; i < EFC_NSRCS * EFC_SRC_SIZE; i++)
+        buf[i] = -i;
+    if (H5Dwrite(vdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR
+    if (H5F__get_nopen_files_test(&nfiles) < 0)
+        TEST_ERROR
+    if (nfiles > nfiles_base + EFC_CACHE_SIZE + EFC_NSRCS)
+        TEST_ERROR
+    HDmemset(rbuf, 0, sizeof rbuf);
+    if (H5Dread(vdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if (H5F__get_nopen_files_test(&nfiles) < 0)
+        TEST_ERROR
+    if (nfiles > nfiles_base + EFC_CACHE_SIZE + EFC_NSRCS)
+        TEST_ERROR
+    for (i = 0; i < (int)(EFC_NSRCS * EFC_SRC_SIZE); i++)
+        if (rbuf[i] != buf[i])
+            TEST_ERROR
+
+    /* Read the first source dataset alone; the source datasets the full
+     * extent I/O left open must be closed now */
+    start = 0;
+    count = EFC_SRC_SIZE;
+    if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(memspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, sizeof rbuf);
+    if (H5Dread(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if (H5F__get_nopen_files_test(&nfiles) < 0)
+        TEST_ERROR
+    if (nfiles > nfiles_base + EFC_CACHE_SIZE + 1)
+        TEST_ERROR
+    for (i = 0; i < EFC_SRC_SIZE; i++)
+        if (rbuf[i] != buf[i])
+            TEST_ERROR
+
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR
+    vdset = -1;
+    if (H5Fclose(vfile) < 0)
+        TEST_ERROR
+    vfile = -1;
+
+    /* Every source file must hold the written values */
+    for (i = 0; i < EFC_NSRCS; i++) {
+        h5_fixname(FILENAME[13 + i], fapl, srcfilename, sizeof srcfilename);
+        if ((srcfile = H5Fopen(srcfilename, H5F_ACC_RDONLY, fapl)) < 0)
+            TEST_ERROR
+        if ((srcdset = H5Dopen2(srcfile, "src_dset", H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Dread(srcdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        for (j = 0; j < EFC_SRC_SIZE; j++)
+            if (rbuf[j] != buf[i * EFC_SRC_SIZE + j])
+                TEST_ERROR
+        if (H5Dclose(srcdset) < 0)
+            TEST_ERROR
+        srcdset = -1;
+        if (H5Fclose(srcfile) < 0)
+            TEST_ERROR
+        srcfile = -1;
+    } /* end for */
+
+    /* Close */
+    if (H5Sclose(memspace) < 0)
+        TEST_ERROR
+    if (H5Sclose(vspace) < 0)
+        TEST_ERROR
+    if (H5Sclose(srcspace) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Pclose(efc_fapl) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(vdset);
+        H5Dclose(srcdset);
+        H5Fclose(vfile);
+        H5Fclose(srcfile);
+        H5Sclose(memspace);
+        H5Sclose(vspace);
+        H5Sclose(srcspace);
+        H5Pclose(dcpl);
+        H5Pclose(efc_fapl);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* end test_efc_source_dsets() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -12389,6 +12638,7 @@ main(void)
 #endif /* VDS_TEST_VERBOSE */
 
             nerrors += test_dapl_values(vds_fapl);
+            nerrors += test_efc_source_dsets(vds_fapl);
 
             /* Verify symbol table messages are cached */
             nerrors += (h5_verify_cached_stabs(FILENAME, vds_fapl) < 0 ? 1 : 0);
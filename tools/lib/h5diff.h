@@ -92,6 +92,12 @@ typedef struct {
     hbool_t                   custom_vol[2];           /* Using a custom input, output VOL? */
 } diff_opt_t;
 
+/* Whether comparing more elements can change the outcome: -n stops after
+ * its count of differences, and quiet mode only reports whether there are
+ * any differences at all */
+#define H5DIFF_DONE(OPTS, NFOUND)                                                                            \
+    (((OPTS)->count_bool && (NFOUND) >= (OPTS)->count) || ((OPTS)->mode_quiet && (NFOUND) > 0))
+
 /*-------------------------------------------------------------------------
  * public functions
  *-------------------------------------------------------------------------
@@ -264,7 +264,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(float);
                     mem2 += sizeof(float);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -274,7 +274,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(double);
                     mem2 += sizeof(double);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -285,7 +285,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(long double);
                     mem2 += sizeof(long double);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -299,7 +299,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
                     nfound += diff_schar_element(mem1, mem2, i, opts);
                     mem1 += sizeof(char);
                     mem2 += sizeof(char);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -309,7 +309,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(unsigned char);
                     mem2 += sizeof(unsigned char);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -319,7 +319,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(short);
                     mem2 += sizeof(short);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -329,7 +329,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(unsigned short);
                     mem2 += sizeof(unsigned short);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -339,7 +339,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(int);
                     mem2 += sizeof(int);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -349,7 +349,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(unsigned int);
                     mem2 += sizeof(unsigned int);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -359,7 +359,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(long);
                     mem2 += sizeof(long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -369,7 +369,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(unsigned long);
                     mem2 += sizeof(unsigned long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -379,7 +379,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(long long);
                     mem2 += sizeof(long long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -389,7 +389,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
 
                     mem1 += sizeof(unsigned long long);
                     mem2 += sizeof(unsigned long long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (H5DIFF_DONE(opts, nfound))
                         return nfound;
                 } /* nelmts */
             }
@@ -414,7 +414,7 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
                 H5TOOLS_DEBUG("opts->pos[%ld]:%ld - nelmts:%ld", i, opts->pos[i], opts->hs_nelmts);
                 nfound += diff_datum(mem1 + i * size, mem2 + i * size, i, opts, container1_id, container2_id,
                                      &members);
-                if (opts->count_bool && nfound >= opts->count)
+                if (H5DIFF_DONE(opts, nfound))
                     break;
             } /* i */
             close_member_types(&members);
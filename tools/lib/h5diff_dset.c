@@ -693,15 +693,16 @@ diff_datasetid(hid_t did1, hid_t did2, const char *obj1_name, const char *obj2_n
                 }
             }
 
+            /* the strip mine buffers are reused for every pass */
+            if (NULL == (sm_buf1 = (unsigned char *)HDmalloc((size_t)sm_nbytes)))
+                H5TOOLS_GOTO_ERROR(H5DIFF_ERR, "Could not allocate buffer for strip-mine");
+            if (NULL == (sm_buf2 = (unsigned char *)HDmalloc((size_t)sm_nbytes)))
+                H5TOOLS_GOTO_ERROR(H5DIFF_ERR, "Could not allocate buffer for strip-mine");
+
             H5TOOLS_DEBUG("opts->nelmts: %ld", opts->nelmts);
             for (elmtno = 0; elmtno < opts->nelmts; elmtno += opts->hs_nelmts) {
                 H5TOOLS_DEBUG("elmtno: %ld - hs_nelmts1: %ld", elmtno, hs_nelmts1);
 
-                if (NULL == (sm_buf1 = (unsigned char *)HDmalloc((size_t)sm_nbytes)))
-                    H5TOOLS_GOTO_ERROR(H5DIFF_ERR, "Could not allocate buffer for strip-mine");
-                if (NULL == (sm_buf2 = (unsigned char *)HDmalloc((size_t)sm_nbytes)))
-                    H5TOOLS_GOTO_ERROR(H5DIFF_ERR, "Could not allocate buffer for strip-mine");
-
                 /* calculate the hyperslab size */
                 /* initialize subset */
                 if (opts->rank > 0) {
@@ -806,23 +807,20 @@ diff_datasetid(hid_t did1, hid_t did2, const char *obj1_name, const char *obj2_n
                 found in each hyperslab and pass the position at the beginning for printing */
                 nfound += diff_array(sm_buf1, sm_buf2, opts, did1, did2);
 
-                if (sm_buf1 != NULL) {
-                    /* reclaim any VL memory, if necessary */
-                    if (vl_data1)
-                        H5Treclaim(m_tid1, sm_space1, H5P_DEFAULT, sm_buf1);
-                    HDfree(sm_buf1);
-                    sm_buf1 = NULL;
-                }
-                if (sm_buf2 != NULL) {
-                    /* reclaim any VL memory, if necessary */
-                    if (vl_data2)
-                        H5Treclaim(m_tid2, sm_space2, H5P_DEFAULT, sm_buf2);
-                    HDfree(sm_buf2);
-                    sm_buf2 = NULL;
-                }
+                /* reclaim any VL memory, if necessary */
+                if (vl_data1)
+                    H5Treclaim(m_tid1, sm_space1, H5P_DEFAULT, sm_buf1);
+                if (vl_data2)
+                    H5Treclaim(m_tid2, sm_space2, H5P_DEFAULT, sm_buf2);
 
                 H5Sclose(sm_space1);
+                sm_space1 = H5I_INVALID_HID;
                 H5Sclose(sm_space2);
+                sm_space2 = H5I_INVALID_HID;
+
+                /* no need to read further strips once the outcome is known */
+                if (H5DIFF_DONE(opts, nfound))
+                    break;
 
                 /* calculate the next hyperslab offset */
                 for (i = opts->rank, carry = 1; i > 0 && carry; --i) {
@@ -864,6 +862,11 @@ diff_datasetid(hid_t did1, hid_t did2, const char *obj1_name, const char *obj2_n
                     H5TOOLS_DEBUG("[%d]hs_offset2:%ld", i - 1, hs_offset2[i - 1]);
                 }
             } /* elmtno for loop */
+
+            HDfree(sm_buf1);
+            sm_buf1 = NULL;
+            HDfree(sm_buf2);
+            sm_buf2 = NULL;
         }     /* hyperslab read */
         H5TOOLS_DEBUG("can compare complete");
     } /*can_compare*/
@@ -903,14 +906,14 @@ done:
     H5TOOLS_DEBUG("reclaim any stripmine VL memory");
     if (sm_buf1 != NULL) {
         /* reclaim any VL memory, if necessary */
-        if (vl_data1)
+        if (vl_data1 && sm_space1 != H5I_INVALID_HID)
             H5Treclaim(m_tid1, sm_space1, H5P_DEFAULT, sm_buf1);
         HDfree(sm_buf1);
         sm_buf1 = NULL;
     }
     if (sm_buf2 != NULL) {
         /* reclaim any VL memory, if necessary */
-        if (vl_data2)
+        if (vl_data2 && sm_space2 != H5I_INVALID_HID)
             H5Treclaim(m_tid2, sm_space2, H5P_DEFAULT, sm_buf2);
         HDfree(sm_buf2);
         sm_buf2 = NULL;
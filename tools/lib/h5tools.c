@@ -1072,10 +1072,9 @@ h5tools_detect_vlen_str(hid_t tid)
             goto done;
         }
         ret = h5tools_detect_vlen_str(btid);
-        if ((ret == TRUE) || (ret < 0)) {
-            H5Tclose(btid);
+        H5Tclose(btid);
+        if ((ret == TRUE) || (ret < 0))
             goto done;
-        }
     }
     else if (tclass == H5T_COMPOUND) {
         unsigned nmembs;
@@ -1707,8 +1706,9 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t
                 size_t bytes_in    = 0; /* # of bytes to write  */
                 size_t bytes_wrote = 0; /* # of bytes written   */
 
-                if (block_index > sizeof(size_t))
-                    bytes_in = sizeof(size_t);
+                /* Write as much of the block as fwrite can take in one call */
+                if (block_index > (hsize_t)SIZE_MAX)
+                    bytes_in = SIZE_MAX;
                 else
                     bytes_in = (size_t)block_index;
 
@@ -1722,10 +1722,9 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t
             }
             break;
         case H5T_STRING: {
-            unsigned int  i;
-            H5T_str_t     pad;
-            char *        s = NULL;
-            unsigned char tempuchar;
+            size_t    i;
+            H5T_str_t pad;
+            char *    s = NULL;
 
             H5TOOLS_DEBUG("H5T_STRING");
             pad = H5Tget_strpad(tid);
@@ -1743,11 +1742,11 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t
                 else {
                     s = (char *)mem;
                 }
-                for (i = 0; i < size && (s[i] || pad != H5T_STR_NULLTERM); i++) {
-                    HDmemcpy(&tempuchar, &s[i], sizeof(unsigned char));
-                    if (1 != HDfwrite(&tempuchar, sizeof(unsigned char), 1, stream))
-                        H5TOOLS_THROW((-1), "fwrite failed");
-                } /* i */
+                /* Write the string up to its terminator in one call */
+                for (i = 0; i < size && (s[i] || pad != H5T_STR_NULLTERM); i++)
+                    ;
+                if (i > 0 && i != HDfwrite(s, sizeof(unsigned char), i, stream))
+                    H5TOOLS_THROW((-1), "fwrite failed");
             }     /* for (block_index = 0; block_index < block_nelmts; block_index++) */
         } break;
         case H5T_COMPOUND: {
@@ -112,16 +112,15 @@ h5trav_set_verbose(int print_verbose)
 /*-------------------------------------------------------------------------
  * Function: trav_token_add
  *
- * Purpose:  Add an object token to visited data structure
+ * Purpose:  Add an object token to visited data structure, at the position
+ *           returned by trav_token_visited() to keep the tokens sorted
  *
  * Return:   void
  *-------------------------------------------------------------------------
  */
 static void
-trav_token_add(trav_addr_t *visited, H5O_token_t *token, const char *path)
+trav_token_add(trav_addr_t *visited, H5O_token_t *token, const char *path, size_t idx)
 {
-    size_t idx; /* Index of address to use */
-
     /* Allocate space if necessary */
     if (visited->nused == visited->nalloc) {
         visited->nalloc = MAX(1, visited->nalloc * 2);
@@ -130,8 +129,11 @@ trav_token_add(trav_addr_t *visited, H5O_token_t *token, const char *path)
             (trav_addr_path_t *)HDrealloc(visited->objs, visited->nalloc * sizeof(trav_addr_path_t));
     } /* end if */
 
-    /* Append it */
-    idx = visited->nused++;
+    /* Insert it */
+    if (idx < visited->nused)
+        HDmemmove(&visited->objs[idx + 1], &visited->objs[idx],
+                  (visited->nused - idx) * sizeof(trav_addr_path_t));
+    visited->nused++;
     HDmemcpy(&visited->objs[idx].token, token, sizeof(H5O_token_t));
     visited->objs[idx].path = HDstrdup(path);
 } /* end trav_token_add() */
@@ -139,28 +141,43 @@ trav_token_add(trav_addr_t *visited, H5O_token_t *token, const char *path)
 /*-------------------------------------------------------------------------
  * Function: trav_token_visited
  *
- * Purpose:  Check if an object token has already been seen
+ * Purpose:  Check if an object token has already been seen.  The tokens
+ *           are kept sorted, so this is a binary search.  PATH is set to
+ *           the path the object was first seen at, or to NULL when the
+ *           token isn't found, in which case IDX is set to where it should
+ *           be inserted.
  *
- * Return:   TRUE/FALSE
+ * Return:   0 on success,
+ *          -1 when tokens can't be compared
  *-------------------------------------------------------------------------
  */
-H5_ATTR_PURE static const char *
-trav_token_visited(hid_t loc_id, trav_addr_t *visited, H5O_token_t *token)
+static int
+trav_token_visited(hid_t loc_id, trav_addr_t *visited, H5O_token_t *token, const char **path, size_t *idx)
 {
-    size_t u; /* Local index variable */
+    size_t lo = 0, hi = visited->nused; /* Bounds of the search range */
     int    token_cmp;
 
+    *path = NULL;
+
     /* Look for address */
-    for (u = 0; u < visited->nused; u++) {
-        /* Check for address already in array */
-        if (H5Otoken_cmp(loc_id, &visited->objs[u].token, token, &token_cmp) < 0)
-            return NULL;
-        if (!token_cmp)
-            return (visited->objs[u].path);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (H5Otoken_cmp(loc_id, &visited->objs[mid].token, token, &token_cmp) < 0)
+            return (-1);
+        if (!token_cmp) {
+            *path = visited->objs[mid].path;
+            return (0);
+        } /* end if */
+        if (token_cmp < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
 
     /* Didn't find object token */
-    return (NULL);
+    *idx = lo;
+    return (0);
 } /* end trav_token_visited() */
 
 /*-------------------------------------------------------------------------
@@ -209,9 +226,17 @@ traverse_cb(hid_t loc_id, const char *path, const H5L_info2_t *linfo, void *_uda
         /* If the object has multiple links, add it to the list of addresses
          *  already visited, if it isn't there already
          */
-        if (oinfo.rc > 1)
-            if (NULL == (already_visited = trav_token_visited(loc_id, udata->seen, &oinfo.token)))
-                trav_token_add(udata->seen, &oinfo.token, full_name);
+        if (oinfo.rc > 1) {
+            size_t idx = 0; /* Where to insert the token */
+
+            if (trav_token_visited(loc_id, udata->seen, &oinfo.token, &already_visited, &idx) < 0) {
+                if (new_name)
+                    HDfree(new_name);
+                return (H5_ITER_ERROR);
+            } /* end if */
+            if (NULL == already_visited)
+                trav_token_add(udata->seen, &oinfo.token, full_name, idx);
+        } /* end if */
 
         /* Make 'visit object' callback */
         if (udata->visitor->visit_obj)
@@ -273,7 +298,7 @@ traverse(hid_t file_id, const char *grp_name, hbool_t visit_start, hbool_t recur
 
         /* Check for multiple links to top group */
         if (oinfo.rc > 1)
-            trav_token_add(&seen, &oinfo.token, grp_name);
+            trav_token_add(&seen, &oinfo.token, grp_name, (size_t)0);
 
         /* Set up user data structure */
         udata.seen          = &seen;
@@ -41,6 +41,8 @@ static int  get_hyperslab(hid_t dcpl_id, int rank_dset, const hsize_t dims_dset[
                           hsize_t dims_hslab[], hsize_t *hslab_nbytes_p);
 static void print_dataset_info(hid_t dcpl_id, char *objname, double per, int pr);
 static int  do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *options);
+static int  same_chunk_storage(hid_t dset_in, hid_t dset_out);
+static int  copy_chunks_raw(hid_t dset_in, hid_t dset_out, int rank, const hsize_t dims[]);
 static int  copy_user_block(const char *infile, const char *outfile, hsize_t size);
 #if defined(H5REPACK_DEBUG_USER_BLOCK)
 static void print_user_block(const char *filename, hid_t fid);
@@ -636,6 +638,7 @@ do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
     hsize_t            dsize_out;          /* output dataset size after filter */
     int                apply_s;            /* flag for apply filter to small dataset sizes */
     int                apply_f;            /* flag for apply filter to return error on H5Dcreate */
+    int                raw_copy;           /* flag for copying chunks without filtering */
     void *             buf       = NULL;   /* buffer for raw data */
     void *             hslab_buf = NULL;   /* hyperslab buffer for raw data */
     int                has_filter;         /* current object has a filter */
@@ -987,7 +990,18 @@ do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
                                  * read/write
                                  *-------------------------------------------------------------------------
                                  */
-                                if (nelmts > 0 && space_status != H5D_SPACE_STATUS_NOT_ALLOCATED) {
+                                raw_copy = 0;
+                                if (nelmts > 0 && space_status != H5D_SPACE_STATUS_NOT_ALLOCATED)
+                                    if ((raw_copy = same_chunk_storage(dset_in, dset_out)) < 0)
+                                        H5TOOLS_GOTO_ERROR((-1), "same_chunk_storage failed");
+
+                                /* if the chunks are stored the same way, copy them without
+                                 * decoding and re-encoding them through the filter pipeline */
+                                if (raw_copy) {
+                                    if (copy_chunks_raw(dset_in, dset_out, rank, dims) < 0)
+                                        H5TOOLS_GOTO_ERROR((-1), "copy_chunks_raw failed");
+                                }
+                                else if (nelmts > 0 && space_status != H5D_SPACE_STATUS_NOT_ALLOCATED) {
                                     size_t need = (size_t)(nelmts * msize); /* bytes needed */
 
                                     /* have to read the whole dataset if there is only one element in the
@@ -1401,6 +1415,187 @@ done:
     return ret_value;
 } /* end do_copy_objects() */
 
+/*-------------------------------------------------------------------------
+ * Function: same_chunk_storage
+ *
+ * Purpose: check if the chunks of the input dataset can be copied to the
+ *          output dataset as they are stored, i.e. without decoding and
+ *          re-encoding them through the filter pipeline. This is the case
+ *          when both datasets are chunked with the same chunk dimensions,
+ *          chunk options, filter pipeline and datatype.
+ *
+ * Return: 1 if the chunk storage is the same, 0 if not, -1 on error
+ *-------------------------------------------------------------------------
+ */
+static int
+same_chunk_storage(hid_t dset_in, hid_t dset_out)
+{
+    hid_t        dcpl_in  = H5I_INVALID_HID;
+    hid_t        dcpl_out = H5I_INVALID_HID;
+    hid_t        type_in  = H5I_INVALID_HID;
+    hid_t        type_out = H5I_INVALID_HID;
+    hsize_t      chunk_in[H5S_MAX_RANK];
+    hsize_t      chunk_out[H5S_MAX_RANK];
+    unsigned     opts_in, opts_out;
+    int          rank_in, rank_out;
+    int          nfilters;
+    int          j, k;
+    htri_t       equal;
+    int          ret_value = 1;
+
+    if ((dcpl_in = H5Dget_create_plist(dset_in)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Dget_create_plist failed");
+    if ((dcpl_out = H5Dget_create_plist(dset_out)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Dget_create_plist failed");
+
+    /* layout */
+    if (H5Pget_layout(dcpl_in) != H5D_CHUNKED || H5Pget_layout(dcpl_out) != H5D_CHUNKED)
+        H5TOOLS_GOTO_DONE(0);
+    if ((rank_in = H5Pget_chunk(dcpl_in, H5S_MAX_RANK, chunk_in)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_chunk failed");
+    if ((rank_out = H5Pget_chunk(dcpl_out, H5S_MAX_RANK, chunk_out)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_chunk failed");
+    if (rank_in != rank_out)
+        H5TOOLS_GOTO_DONE(0);
+    for (k = 0; k < rank_in; k++)
+        if (chunk_in[k] != chunk_out[k])
+            H5TOOLS_GOTO_DONE(0);
+    if (H5Pget_chunk_opts(dcpl_in, &opts_in) < 0 || H5Pget_chunk_opts(dcpl_out, &opts_out) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_chunk_opts failed");
+    if (opts_in != opts_out)
+        H5TOOLS_GOTO_DONE(0);
+
+    /* filters */
+    if ((nfilters = H5Pget_nfilters(dcpl_in)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_nfilters failed");
+    if (nfilters != H5Pget_nfilters(dcpl_out))
+        H5TOOLS_GOTO_DONE(0);
+    for (j = 0; j < nfilters; j++) {
+        H5Z_filter_t filtn_in, filtn_out;
+        unsigned     flags_in, flags_out;
+        unsigned     cd_in[20], cd_out[20];
+        size_t       cd_nelmts_in  = NELMTS(cd_in);
+        size_t       cd_nelmts_out = NELMTS(cd_out);
+
+        if ((filtn_in = H5Pget_filter2(dcpl_in, (unsigned)j, &flags_in, &cd_nelmts_in, cd_in, 0, NULL,
+                                       NULL)) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Pget_filter2 failed");
+        if ((filtn_out = H5Pget_filter2(dcpl_out, (unsigned)j, &flags_out, &cd_nelmts_out, cd_out, 0, NULL,
+                                        NULL)) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Pget_filter2 failed");
+
+        /* be conservative with parameters that did not fit in the buffers */
+        if (filtn_in != filtn_out || flags_in != flags_out || cd_nelmts_in != cd_nelmts_out ||
+            cd_nelmts_in > NELMTS(cd_in))
+            H5TOOLS_GOTO_DONE(0);
+        for (k = 0; k < (int)cd_nelmts_in; k++)
+            if (cd_in[k] != cd_out[k])
+                H5TOOLS_GOTO_DONE(0);
+    }
+
+    /* datatype */
+    if ((type_in = H5Dget_type(dset_in)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Dget_type failed");
+    if ((type_out = H5Dget_type(dset_out)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Dget_type failed");
+    if ((equal = H5Tequal(type_in, type_out)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Tequal failed");
+    if (!equal)
+        H5TOOLS_GOTO_DONE(0);
+
+    /* variable-length data are stored in the file's global heap, not in the
+     * chunks; look for variable-length sequences and strings at any depth */
+    if (h5tools_detect_vlen(type_in) != FALSE)
+        H5TOOLS_GOTO_DONE(0);
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl_in);
+        H5Pclose(dcpl_out);
+        H5Tclose(type_in);
+        H5Tclose(type_out);
+    }
+    H5E_END_TRY;
+
+    return ret_value;
+} /* end same_chunk_storage() */
+
+/*-------------------------------------------------------------------------
+ * Function: copy_chunks_raw
+ *
+ * Purpose: copy all the allocated chunks of a dataset to another dataset
+ *          with the same chunk storage (see same_chunk_storage), as raw
+ *          (still filtered) chunks. Chunks that were never written are
+ *          left to the fill value in the output dataset.
+ *
+ * Return: 0, ok, -1 no
+ *-------------------------------------------------------------------------
+ */
+static int
+copy_chunks_raw(hid_t dset_in, hid_t dset_out, int rank, const hsize_t dims[])
+{
+    hid_t    dcpl_id = H5I_INVALID_HID;
+    hsize_t  chunk_dims[H5S_MAX_RANK];
+    hsize_t  offset[H5S_MAX_RANK];
+    hsize_t  chunk_nbytes;
+    uint32_t filter_mask;
+    void *   chunk_buf = NULL;
+    size_t   buf_size  = 0;
+    int      k, carry;
+    int      ret_value = 0;
+
+    if ((dcpl_id = H5Dget_create_plist(dset_in)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Dget_create_plist failed");
+    if (H5Pget_chunk(dcpl_id, rank, chunk_dims) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_chunk failed");
+
+    /* visit the chunks in the order they are laid out, last dimension fastest */
+    HDmemset(offset, 0, sizeof offset);
+    do {
+        /* the size is 0 for chunks that were never written */
+        if (H5Dget_chunk_info_by_coord(dset_in, offset, NULL, NULL, &chunk_nbytes) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Dget_chunk_info_by_coord failed");
+
+        if (chunk_nbytes > 0) {
+            if (chunk_nbytes > buf_size) {
+                HDfree(chunk_buf);
+                buf_size = (size_t)chunk_nbytes;
+                if (NULL == (chunk_buf = HDmalloc(buf_size)))
+                    H5TOOLS_GOTO_ERROR((-1), "can't allocate space for chunk");
+            }
+
+            if (H5Dread_chunk(dset_in, H5P_DEFAULT, offset, &filter_mask, chunk_buf) < 0)
+                H5TOOLS_GOTO_ERROR((-1), "H5Dread_chunk failed");
+            if (H5Dwrite_chunk(dset_out, H5P_DEFAULT, filter_mask, offset, (size_t)chunk_nbytes, chunk_buf) <
+                0)
+                H5TOOLS_GOTO_ERROR((-1), "H5Dwrite_chunk failed");
+        }
+
+        /* calculate the next chunk offset */
+        for (k = rank, carry = 1; k > 0 && carry; --k) {
+            offset[k - 1] += chunk_dims[k - 1];
+            /* if reached the end of a dim */
+            if (offset[k - 1] >= dims[k - 1])
+                offset[k - 1] = 0;
+            else
+                carry = 0;
+        }
+    } while (!carry);
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl_id);
+    }
+    H5E_END_TRY;
+
+    if (chunk_buf != NULL)
+        HDfree(chunk_buf);
+
+    return ret_value;
+} /* end copy_chunks_raw() */
+
 /*-------------------------------------------------------------------------
  * Function: print_dataset_info
  *
@@ -80,6 +80,9 @@
 
 #define FNAME18 "h5repack_layout2.h5"
 
+#define FNAME19    "h5repack_vlstr.h5"
+#define FNAME19OUT "h5repack_vlstr_out.h5"
+
 /* Files for testing file space paging */
 #define FSPACE_OUT "h5repack_fspace_OUT.h5"   /* The output file */
 #define NELMTS(X)  (sizeof(X) / sizeof(X[0])) /* # of elements */
@@ -147,6 +150,7 @@ static int make_scaleoffset(hid_t loc_id);
 static int make_all_filters(hid_t loc_id);
 static int make_fill(hid_t loc_id);
 static int make_big(hid_t loc_id);
+static int make_vlstr_chunked(hid_t loc_id);
 static int make_testfiles(void);
 static int write_dset_in(hid_t loc_id, const char *dset_name, hid_t file_id, int make_diffs);
 static int write_attr_in(hid_t loc_id, const char *dset_name, hid_t fid, int make_diffs);
@@ -1707,6 +1711,26 @@ main(void)
         GOERROR;
     PASSED();
 
+    /*-------------------------------------------------------------------------
+     * a filter on one dataset only; the chunks of the untouched
+     * variable-length string dataset must not be copied as raw bytes
+     *-------------------------------------------------------------------------
+     */
+    TESTING("    chunked variable-length strings next to a filtered dataset");
+    if (h5repack_init(&pack_options, 0, FALSE) < 0)
+        GOERROR;
+    if (h5repack_addfilter("dset_other:SHUF", &pack_options) < 0)
+        GOERROR;
+    if (h5repack(FNAME19, FNAME19OUT, &pack_options) < 0)
+        GOERROR;
+    if (h5diff(FNAME19, FNAME19OUT, NULL, NULL, &diff_options) > 0)
+        GOERROR;
+    if (h5repack_verify(FNAME19, FNAME19OUT, &pack_options) <= 0)
+        GOERROR;
+    if (h5repack_end(&pack_options) < 0)
+        GOERROR;
+    PASSED();
+
     /*-------------------------------------------------------------------------
      * clean temporary test files
      *-------------------------------------------------------------------------
@@ -1813,6 +1837,19 @@ make_testfiles(void)
     if (H5Fclose(fid) < 0)
         return -1;
 
+    /*-------------------------------------------------------------------------
+     * create a file with a chunked variable-length string dataset
+     *-------------------------------------------------------------------------
+     */
+    if ((fid = H5Fcreate(FNAME19, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        return -1;
+
+    if (make_vlstr_chunked(fid) < 0)
+        goto out;
+
+    if (H5Fclose(fid) < 0)
+        return -1;
+
     /*-------------------------------------------------------------------------
      * for test layout conversions form chunk with unlimited max dims
      *-------------------------------------------------------------------------
@@ -3310,6 +3347,125 @@ error:
 
 } /* make_layout2() */
 
+/*-------------------------------------------------------------------------
+ * Function: make_vlstr_chunked
+ *
+ * Purpose: make chunked datasets holding variable-length strings, as the
+ *          whole element ("dset_vlstr"), in an array ("dset_vlstr_array")
+ *          and in an array member of a compound ("dset_vlstr_cmpd"), and
+ *          a plain integer dataset "dset_other" to apply a filter to
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+make_vlstr_chunked(hid_t loc_id)
+{
+    typedef struct {
+        int         i;
+        const char *s[2];
+    } vlstr_cmpd_t;
+
+    hid_t        did           = H5I_INVALID_HID; /* dataset ID */
+    hid_t        tid           = H5I_INVALID_HID; /* variable-length string type ID */
+    hid_t        atid          = H5I_INVALID_HID; /* array type ID */
+    hid_t        ctid          = H5I_INVALID_HID; /* compound type ID */
+    hid_t        sid           = H5I_INVALID_HID; /* dataspace ID */
+    hid_t        asid          = H5I_INVALID_HID; /* dataspace ID for the array datasets */
+    hid_t        dcpl          = H5I_INVALID_HID; /* dataset creation property list */
+    hsize_t      dims[1]       = {8};
+    hsize_t      adims[1]      = {4};
+    hsize_t      array_dims[1] = {2};
+    hsize_t      chunk_dims[1] = {2};
+    const char * buf[8]        = {"zero", "one", "two", "three", "four", "five", "six", "seven"};
+    int          ibuf[8]       = {0, 1, 2, 3, 4, 5, 6, 7};
+    vlstr_cmpd_t cbuf[4];
+    unsigned     u;
+
+    for (u = 0; u < 4; u++) {
+        cbuf[u].i    = (int)u;
+        cbuf[u].s[0] = buf[2 * u];
+        cbuf[u].s[1] = buf[2 * u + 1];
+    }
+
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((asid = H5Screate_simple(1, adims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        goto error;
+
+    if ((tid = H5Tcopy(H5T_C_S1)) < 0)
+        goto error;
+    if (H5Tset_size(tid, H5T_VARIABLE) < 0)
+        goto error;
+    if ((did = H5Dcreate2(loc_id, "dset_vlstr", tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    /* an array of two strings, filled from the same eight strings */
+    if ((atid = H5Tarray_create2(tid, 1, array_dims)) < 0)
+        goto error;
+    if ((did = H5Dcreate2(loc_id, "dset_vlstr_array", atid, asid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, atid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    /* a compound with a member that is such an array */
+    if ((ctid = H5Tcreate(H5T_COMPOUND, sizeof(vlstr_cmpd_t))) < 0)
+        goto error;
+    if (H5Tinsert(ctid, "i", HOFFSET(vlstr_cmpd_t, i), H5T_NATIVE_INT) < 0)
+        goto error;
+    if (H5Tinsert(ctid, "s", HOFFSET(vlstr_cmpd_t, s), atid) < 0)
+        goto error;
+    if ((did = H5Dcreate2(loc_id, "dset_vlstr_cmpd", ctid, asid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, ctid, H5S_ALL, H5S_ALL, H5P_DEFAULT, cbuf) < 0)
+        goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    if (H5Tclose(ctid) < 0)
+        goto error;
+    if (H5Tclose(atid) < 0)
+        goto error;
+    if (H5Tclose(tid) < 0)
+        goto error;
+
+    if (make_dset(loc_id, "dset_other", sid, dcpl, ibuf) < 0)
+        goto error;
+
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+    if (H5Sclose(asid) < 0)
+        goto error;
+    if (H5Sclose(sid) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Tclose(ctid);
+        H5Tclose(atid);
+        H5Tclose(tid);
+        H5Pclose(dcpl);
+        H5Sclose(asid);
+        H5Sclose(sid);
+    }
+    H5E_END_TRY;
+
+    return -1;
+} /* make_vlstr_chunked() */
+
 /*-------------------------------------------------------------------------
  * Function: make_layout3
  *